@@ -4,9 +4,9 @@
 
 #include <stdlib.h>
 #include <stdio.h>
-#include <math.h>
 #include "./tbassert.h"
 #include "./precomp_tables.h"
+#include "./scheduler.h"
 
 // -----------------------------------------------------------------------------
 // Evaluation
@@ -14,7 +14,8 @@
 
 typedef int32_t ev_score_t;  // Static evaluator uses "hi res" values
 
-uint8_t RANDOMIZE;
+int RANDOMIZE;
+int EVAL_CACHE;  // size of each thread's eval cache in KBytes, 0 to disable
 
 //uint8_t PCENTRAL;
 int HATTACK;
@@ -24,13 +25,6 @@ int KFACE;
 int KAGGRESSIVE;
 int MOBILITY;
 int PAWNPIN;
-typedef struct heuristics_t {
-  int8_t pawnpin;
-  int8_t h_attackable;
-  int8_t mobility;
-} heuristics_t;
-
-heuristics_t * mark_laser_path_heuristics(position_t *p, color_t c, heuristics_t * heuristics);
 
 // Heuristics for static evaluation - described in the google doc
 // mentioned in the handout.
@@ -38,15 +32,9 @@ bool inRange(const int min, const int max, const int val);
 
 // PCENTRAL heuristic: Bonus for Pawn near center of board
 ev_score_t pcentral(const fil_t f, const rnk_t r) {
-  int df = BOARD_WIDTH/2 - f -1;
-  if (df < 0)  df = f - BOARD_WIDTH/2;
-  int dr  = BOARD_WIDTH/2 - r -1;
-  if (dr < 0) dr = r - BOARD_WIDTH/2;
-  const double bonus = 1 - sqrt(df * df + dr * dr)*BONUS_MULTIPLIER;
-  return PCENTRAL * bonus;
+  return (PCENTRAL * pcentral_table[f][r]) >> EVAL_TABLE_SHIFT;
 }
 
-
 // returns true if c lies on or between a and b, which are not ordered
 bool between(const int c, const int a, const int b) {
   return ((c >= a) && (c <= b)) || ((c <= a) && (c >= b));
@@ -68,325 +56,192 @@ ev_score_t pbetween(const position_t *p, const fil_t f, const rnk_t r) {
 // KFACE heuristic: bonus (or penalty) for King facing toward the other King
 ev_score_t kface(const position_t *p, const fil_t f, const rnk_t r) {
   const square_t sq = square_of(f, r);
-  const piece_t x = p->board[sq];
+  const piece_t x = piece_at(p, sq);
   const color_t c = color_of(x);
+  tbassert(ptype_of(x) == KING, "ptype_of(x) = %d\n", ptype_of(x));
+
   const square_t opp_sq = p->kloc[opp_color(c)];
   const int delta_fil = fil_of(opp_sq) - f;
   const int delta_rnk = rnk_of(opp_sq) - r;
-  int bonus;
-
-  switch (ori_of(x)) {
-    case NN:
-      bonus = delta_rnk;
-      break;
-
-    case EE:
-      bonus = delta_fil;
-      break;
-
-    case SS:
-      bonus = -delta_rnk;
-      break;
-
-    case WW:
-      bonus = -delta_fil;
-      break;
-
-    default:
-      bonus = 0;
-      tbassert(false, "Illegal King orientation.\n");
-  }
 
-  return (bonus * KFACE) / (abs(delta_rnk) + abs(delta_fil));
+  return (KFACE * kface_table[ori_of(x)][delta_fil + BOARD_WIDTH - 1]
+          [delta_rnk + BOARD_WIDTH - 1]) >> EVAL_TABLE_SHIFT;
 }
 
 // KAGGRESSIVE heuristic: bonus for King with more space to back
 ev_score_t kaggressive(const position_t *p, const fil_t f, const rnk_t r) {
   const square_t sq = square_of(f, r);
-  const piece_t x = p->board[sq];
+  const piece_t x = piece_at(p, sq);
   const color_t c = color_of(x);
   tbassert(ptype_of(x) == KING, "ptype_of(x) = %d\n", ptype_of(x));
 
   const square_t opp_sq = p->kloc[opp_color(c)];
-  const fil_t of = fil_of(opp_sq);
-  const rnk_t _or = (rnk_t) rnk_of(opp_sq);
-
-  int bonus = 0;
-  if(of >= f) {
-    bonus = f +1;
-  } else {
-    bonus = BOARD_WIDTH - f;
+  return (KAGGRESSIVE * kaggressive_table[bb_index_of(sq)][bb_index_of(opp_sq)])
+      >> EVAL_TABLE_SHIFT;
+}
+
+// -----------------------------------------------------------------------------
+// Running sums
+//
+// The terms that depend only on where the pawns and kings are (MATERIAL,
+// PCENTRAL, PBETWEEN, KFACE and KAGGRESSIVE) are kept in p->ev and updated by
+// do_move through the functions below, so eval() only has to add them up.
+// PBETWEEN is kept as a count of pawns so that it does not depend on the
+// weight; the other sums use the weights and are recomputed by
+// init_eval_sums() when a weight changes.
+//
+// A king move changes the king terms and the whole king rectangle, so do_move
+// only marks them stale and eval() recomputes them if it gets there.
+// -----------------------------------------------------------------------------
+
+// MATERIAL and PCENTRAL of a pawn on sq
+static ev_score_t pawn_value(const square_t sq) {
+  return PAWN_EV_VALUE + pcentral(fil_of(sq), rnk_of(sq));
+}
+
+// true if sq is in the rectangle defined by the Kings at the corners
+static bool in_king_rectangle(const position_t *p, const square_t sq) {
+  return between(fil_of(sq), fil_of(p->kloc[WHITE]), fil_of(p->kloc[BLACK])) &&
+      between(rnk_of(sq), rnk_of(p->kloc[WHITE]), rnk_of(p->kloc[BLACK]));
+}
+
+// Recomputes the king terms and the PBETWEEN counts.
+void update_eval_kings(position_t *p) {
+  for (color_t c = 0; c < 2; c++) {
+    const fil_t f = fil_of(p->kloc[c]);
+    const rnk_t r = rnk_of(p->kloc[c]);
+    p->ev.kings[c] = kface(p, f, r) + kaggressive(p, f, r);
+    p->ev.pbetween[c] = 0;
+#if BITBOARD
+    for (bitboard_t pawns = p->color_bb[c] & p->pawn_bb; pawns; pawns &= pawns - 1) {
+      const square_t sq = bb_square_of(bb_lsb(pawns));
+#else
+    for (int i = 0; i < NUMBER_PAWNS; i++) {
+      const square_t sq = p->plocs[c][i];
+      if (sq == 0) continue;
+#endif
+      p->ev.pbetween[c] += in_king_rectangle(p, sq);
+    }
   }
-  if(_or >= r) {
-    bonus *= (r + 1);
-  } else {
-    bonus *= (BOARD_WIDTH - r);
+  p->ev.kings_stale = false;
+}
+
+void update_eval_pawn_moved(position_t *p, const color_t c,
+                            const square_t from_sq, const square_t to_sq) {
+  p->ev.pawns[c] += pawn_value(to_sq) - pawn_value(from_sq);
+  if (!p->ev.kings_stale) {
+    p->ev.pbetween[c] += in_king_rectangle(p, to_sq) - in_king_rectangle(p, from_sq);
   }
+}
 
-  return (KAGGRESSIVE * bonus) / (BOARD_WIDTH * BOARD_WIDTH);
+void update_eval_pawn_removed(position_t *p, const color_t c, const square_t sq) {
+  p->ev.pawns[c] -= pawn_value(sq);
+  p->ev.num_pawns[c]--;
+  if (!p->ev.kings_stale) {
+    p->ev.pbetween[c] -= in_king_rectangle(p, sq);
+  }
 }
 
-// Marks the path of the laser until it hits a piece or goes off the board.
-//
-// p : current board state
-// laser_map : end result will be stored here. Every square on the
-//             path of the laser is marked with mark_mask
-// c : color of king shooting laser
-// mark_mask: what each square is marked with
-void mark_laser_path(position_t *p, char *laser_map, const color_t c,
-                     const char mark_mask) {
-
-  // Fire laser, recording in laser_map
-  square_t sq = p->kloc[c];
-  int8_t bdir = ori_of(p->board[sq]);
-
-  tbassert(ptype_of(p->board[sq]) == KING,
-           "ptype: %d\n", ptype_of(p->board[sq]));
-  laser_map[sq] |= mark_mask;
-  int8_t beam = beam_of(bdir);
-
-  while (true) { 
-    sq += beam;
-    laser_map[sq] |= mark_mask;
-    tbassert(sq < ARR_SIZE && sq >= 0, "sq: %d\n", sq);
-    ptype_t typ = ptype_of(p->board[sq]);
-    switch (typ) {
-      case EMPTY:  // empty square
-        break;
-      case PAWN:  // Pawn
-        bdir = reflect_of(bdir, ori_of(p->board[sq]));
-        if (bdir < 0) {  // Hit back of Pawn
-          return;
-        }
-        beam = beam_of(bdir);
-        break;
-      case KING:  // King
-        return;  // sorry, game over my friend!
-        break;
-      case INVALID:  // Ran off edge of board
-        return;
-        break;
-      default:  // Shouldna happen, man!
-        tbassert(false, "Not cool, man.  Not cool.\n");
-        break;
+// Computes p->ev from scratch.
+void init_eval_sums(position_t *p) {
+  for (color_t c = 0; c < 2; c++) {
+    p->ev.pawns[c] = 0;
+    p->ev.num_pawns[c] = 0;
+#if BITBOARD
+    for (bitboard_t pawns = p->color_bb[c] & p->pawn_bb; pawns; pawns &= pawns - 1) {
+      const square_t sq = bb_square_of(bb_lsb(pawns));
+#else
+    for (int i = 0; i < NUMBER_PAWNS; i++) {
+      const square_t sq = p->plocs[c][i];
+      if (sq == 0) continue;
+#endif
+      p->ev.pawns[c] += pawn_value(sq);
+      p->ev.num_pawns[c]++;
     }
   }
+  update_eval_kings(p);
 }
 
-// Harmonic-ish distance: 1/(|dx|+1) + 1/(|dy|+1)
-// Because we don't want a divide by 0 error, we add one to the dx/dy values
-float h_dist(square_t a, square_t b) {
-    int delta_fil = fil_of(a) - fil_of(b);
-    delta_fil = delta_fil < 0 ? -(delta_fil) : delta_fil;
-    int delta_rnk = rnk_of(a) - rnk_of(b);
-    delta_rnk = delta_rnk < 0 ? -(delta_rnk) : delta_rnk; 
-    delta_fil++;
-    delta_rnk++;
-    return ((float)(delta_rnk + delta_fil))/((float)(delta_rnk*delta_fil));
-}
 
-// Marks the path of the laser until it hits a piece or goes off the board.
-//
-// p : current board state
-// laser_map : end result will be stored here. Every square on the
-//             path of the laser is marked with mark_mask
-// c : color of king shooting laser
-//
-// In the heuristics version of the mark_laser_path method, we are also calculating the three heuristic values
-// pawnpin, mobility, and h_squares_attackable.
+// Fills in li from the laser paths cached in p.  For each color c:
 //
-// PAWNPIN Heuristic: count number of pawns that are pinned by the
+// PAWNPIN Heuristic: count number of pawns of color c that are pinned by the
 //   opposing king's laser --- and are thus immobile.
-// 
-// MOBILITY heuristic: safe squares around king of color opp_color(c).
 //
-// H_ATTACKABLE heuristic: add value the closer the laser comes to the king
-// h_attackable adds the harmonic distance from a marked laser square to the enemy square
-// closer the laser is to enemy king, higher the value is
-heuristics_t * mark_laser_path_heuristics(position_t *p, const color_t c, heuristics_t * heuristics) {
-  square_t king_sq = p->kloc[opp_color(c)];
-  
-  // Initialize the h_squares_attackable value
-  float h_attackable = 0;
-
-  // Fire laser, recording in laser_map
-  square_t sq = p->kloc[c];
-  int8_t bdir = ori_of(p->board[sq]);
-
-  // Create a bounding box around king's square
-  const int8_t right = fil_of(king_sq)+1;
-  const int8_t left = fil_of(king_sq)-1;
-  const int8_t top = rnk_of(king_sq)+1;
-  const int8_t bottom = rnk_of(king_sq)-1;
-  
-  // Column & Row of laser Square
-  rnk_t sq_rank = rnk_of(sq);
-  fil_t sq_file = fil_of(sq);
-
-  // Check to see if the first block the laser fired in is directly surrounding the king, if so decrease mobility
-  if ((sq_file <= right && sq_file >= left) && (sq_rank >= bottom && sq_rank <= top)) {
-      heuristics->mobility--;
-  }
-
-   
-  // Mark any invalid squares surrounding the king as not mobile
-  for (uint8_t d = 0; d < 8; ++d) {
-    square_t new_sq = king_sq + dir_of(d);
-    if (ptype_of(p->board[new_sq]) == INVALID) {
-      heuristics->mobility--;
+// MOBILITY heuristic: safe squares around king of color c.
+//
+// H_ATTACKABLE heuristic: add value the closer the opposing laser comes to
+//   the king of color c.  h_attackable adds the harmonic distance from each
+//   square on the laser path to the king.
+void get_laser_info(position_t *p, laser_info_t *li) {
+  for (color_t c = 0; c < 2; c++) {
+    const color_t opp = opp_color(c);
+    const int king_i = bb_index_of(p->kloc[c]);
+    const bitboard_t path = p->laser_bb[opp];
+    li->path[opp] = path;
+
+    // Every pawn on the path has been hit and pinned by the laser
+#if BITBOARD
+    li->pinned[c] = path & p->pawn_bb & p->color_bb[c];
+#else
+    li->pinned[c] = 0;
+    for (int i = 0; i < NUMBER_PAWNS; i++) {
+      li->pinned[c] |= path & square_bb(p->plocs[c][i]);
     }
-  }
+#endif
+    li->pawnpin[c] = bb_popcount(li->pinned[c]);
 
-  tbassert(ptype_of(p->board[sq]) == KING,
-           "ptype: %d\n", ptype_of(p->board[sq]));
-  int8_t beam = beam_of(bdir);
-  h_attackable += h_dist(sq, king_sq);
-
-  while (true) { 
-    sq += beam;
-    sq_file = fil_of(sq);
-    sq_rank = rnk_of(sq);
-    tbassert(sq < ARR_SIZE && sq >= 0, "sq: %d\n", sq);
-
-    if ((sq_file <= right && sq_file >= left) && (sq_rank >= bottom && sq_rank <= top) && ptype_of(p->board[sq]) != INVALID) {
-      heuristics->mobility--;
-    } 
-
-    switch (ptype_of(p->board[sq])) {
-      case EMPTY:  // empty square
-        h_attackable += h_dist(sq, king_sq);
-        break;
-      case PAWN:  // Pawn
-        h_attackable += h_dist(sq, king_sq);
-        // We have hit a pawn and pinned it, increment appropriately
-        if (color_of(p->board[sq]) != c) {
-          heuristics->pawnpin++;
-        }
-        bdir = reflect_of(bdir, ori_of(p->board[sq]));
-        if (bdir < 0) {  // Hit back of Pawn
-          heuristics->h_attackable = h_attackable;
-          return heuristics;
-        }
-        beam = beam_of(bdir);
-        break;
-      case KING:  // King
-        h_attackable += h_dist(sq, king_sq);
-        heuristics->h_attackable = h_attackable;
-        return heuristics;  // sorry, game over my friend!
-        break;
-      case INVALID:  // Ran off edge of board
-        heuristics->h_attackable = h_attackable;
-        return heuristics;
-        break;
-      default:  // Shouldna happen, man!
-        tbassert(false, "Not cool, man.  Not cool.\n");
-        break;
+    // The on-board part of the 3x3 box around the king
+    const bitboard_t box = neighbor_bb_table[king_i] | ((bitboard_t) 1 << king_i);
+
+    // Mark any invalid squares surrounding the king as not mobile, and so
+    // are the squares of the box the laser passes through
+    li->mobility[c] = 9 - (8 - bb_popcount(neighbor_bb_table[king_i]))
+        - bb_popcount(path & box);
+
+    int h_attackable = 0;  // times H_DIST_SCALE
+    for (bitboard_t b = path; b; b &= b - 1) {
+      h_attackable += h_dist_table[king_i][bb_lsb(b)];
     }
+    li->h_attackable[c] = h_attackable / H_DIST_SCALE;
   }
 }
 
 // Static evaluation.  Returns score
-score_t eval(position_t *p, const bool verbose) {
+//
+// li is the laser info of p, or NULL to have eval compute it.
+score_t eval(position_t *p, const laser_info_t *li, const bool verbose) {
   // seed rand_r with a value of 1, as per
   // http://linux.die.net/man/3/rand_r
   static __thread unsigned int seed = 1;
   // verbose = true: print out components of score
+  if (p->ev.kings_stale) {
+    update_eval_kings(p);
+  }
   ev_score_t score[2] = { 0, 0 };
-  //  int corner[2][2] = { {INF, INF}, {INF, INF} };
-  ev_score_t bonus;
-  //char buf[MAX_CHARS_IN_MOVE]; used for debugging/verbose purposes
-  uint8_t number_pawns[2] = {0,0};
-  rnk_t king_max_rnk = 0;
-  rnk_t king_min_rnk = 16;
-  fil_t king_max_fil = 0;
-  fil_t king_min_fil = 16;
-  for(uint8_t c = 0; c < 2; c ++) {
-    
-    // Adds score for color's king
-    const square_t sq = p->kloc[c];
-    const fil_t f = fil_of(sq);
-    const rnk_t r = rnk_of(sq);
-    king_max_rnk = r > king_max_rnk ? r : king_max_rnk;
-    king_min_rnk = r < king_min_rnk ? r : king_min_rnk;
-    king_max_fil = f > king_max_fil ? f : king_max_fil;
-    king_min_fil = f < king_min_fil ? f : king_min_fil;
-    bonus = kface(p, f, r);
-
-    score[c] += bonus;
-
-    // KAGGRESSIVE heuristic
-    bonus = kaggressive(p, f, r);
-    score[c] += bonus;
+  for (color_t c = 0; c < 2; c++) {
+    // KFACE and KAGGRESSIVE, then MATERIAL and PCENTRAL, then PBETWEEN
+    score[c] = p->ev.kings[c] + p->ev.pawns[c] + PBETWEEN * p->ev.pbetween[c];
   }
-  for(uint8_t c = 0; c < 2; c++) {
-    // Adds score for color's pawns
-    for(uint8_t i = 0; i < NUMBER_PAWNS; i++) {
-      const square_t sq = p->plocs[c][i];
-      if(sq == 0) continue;
-      const fil_t f = fil_of(sq);
-      const rnk_t r = rnk_of(sq);
-      number_pawns[c]++;
-      // MATERIAL heuristic: Bonus for each Pawn
-      bonus = PAWN_EV_VALUE;
-      /*if (verbose) {
-         printf("MATERIAL bonus %d for %s Pawn on %s\n", bonus, color_to_str(c), buf);
-         }*/
-      score[c] += bonus;
-
-      // PBETWEEN heuristic
-      //bonus = pbetween(p, f, r);
-      bonus = inRange(king_min_rnk, king_max_rnk, r) && inRange(king_min_fil, king_max_fil, f) ? PBETWEEN : 0;
-      /*if (verbose) {
-        printf("PBETWEEN bonus %d for %s Pawn on %s\n", bonus, color_to_str(c), buf);
-        }*/
-      score[c] += bonus;
-
-      // PCENTRAL heuristic
-      bonus = pcentral(f, r);
-      /*if (verbose) {
-         printf("PCENTRAL bonus %d for %s Pawn on %s\n", bonus, color_to_str(c), buf);
-         }*/
-      score[c] += bonus;
-    }
+  const uint8_t *number_pawns = p->ev.num_pawns;
+
+  laser_info_t local_li;
+  if (li == NULL) {
+    get_laser_info(p, &local_li);
+    li = &local_li;
   }
 
-  heuristics_t white_heuristics = { .pawnpin = 0, .h_attackable = 0, .mobility = 9};
-  heuristics_t * w_heuristics = &white_heuristics;
-
-  heuristics_t black_heuristics = { .pawnpin = 0, .h_attackable = 0, .mobility = 9};
-  heuristics_t * b_heuristics = &black_heuristics;
-  
-  // Calculate the heurisitics for the white and black color
-  mark_laser_path_heuristics(p, BLACK, w_heuristics);
-  mark_laser_path_heuristics(p, WHITE, b_heuristics);
-
-  const ev_score_t w_hattackable = HATTACK * b_heuristics->h_attackable;
-  score[WHITE] += w_hattackable;
-  /*if (verbose) {
-    printf("HATTACK bonus %d for White\n", w_hattackable);
-    }*/
-  const ev_score_t b_hattackable = HATTACK * w_heuristics->h_attackable;
-  score[BLACK] += b_hattackable;
-  /*if (verbose) {
-    printf("HATTACK bonus %d for Black\n", b_hattackable);
-    }*/
-
-  const int w_mobility = MOBILITY * w_heuristics->mobility;
-  score[WHITE] += w_mobility;
-  /*if (verbose) {
-    printf("MOBILITY bonus %d for White\n", w_mobility);
-    }*/
-  const int b_mobility = MOBILITY * b_heuristics->mobility;
-  score[BLACK] += b_mobility;
-  /*if (verbose) {
-    printf("MOBILITY bonus %d for Black\n", b_mobility);
-    }*/
+  // HATTACK heuristic: bonus for getting the laser close to the enemy king
+  score[WHITE] += HATTACK * li->h_attackable[BLACK];
+  score[BLACK] += HATTACK * li->h_attackable[WHITE];
+
+  // MOBILITY heuristic
+  score[WHITE] += MOBILITY * li->mobility[WHITE];
+  score[BLACK] += MOBILITY * li->mobility[BLACK];
 
   // PAWNPIN Heuristic --- is a pawn immobilized by the enemy laser.
-  const int w_pawnpin = PAWNPIN * (number_pawns[WHITE] - w_heuristics->pawnpin);
-  score[WHITE] += w_pawnpin;
-  const int b_pawnpin = PAWNPIN * (number_pawns[BLACK] - b_heuristics->pawnpin);
-  score[BLACK] += b_pawnpin;
+  score[WHITE] += PAWNPIN * (number_pawns[WHITE] - li->pawnpin[WHITE]);
+  score[BLACK] += PAWNPIN * (number_pawns[BLACK] - li->pawnpin[BLACK]);
 
   // score from WHITE point of view
   ev_score_t tot = score[WHITE] - score[BLACK];
@@ -402,3 +257,95 @@ score_t eval(position_t *p, const bool verbose) {
 
   return tot / EV_SCORE_RATIO;
 }
+
+// -----------------------------------------------------------------------------
+// Eval cache
+//
+// Each worker has its own small direct-mapped table of static scores, so
+// probing and storing need neither locks nor atomics.  Tables are indexed by
+// sched_worker_id(), so a worker started by sched_set_workers() reuses the
+// table of the thread it replaced.  An entry packs the
+// top 48 bits of the position key with the 16-bit score; the low bits of the
+// key select the slot.  An all-zero entry is empty.
+//
+// Tables are allocated on a worker's first probe and thrown away whenever
+// eval_cache_clear() bumps the generation, e.g. after a weight or the cache
+// size changed.
+// -----------------------------------------------------------------------------
+
+#define EVAL_CACHE_SCORE_MASK 0xffffULL
+
+typedef struct eval_cache {
+  uint64_t *entries;
+  uint64_t mask;        // number of entries - 1
+  uint32_t generation;
+  uint64_t probes;
+  uint64_t hits;
+} eval_cache_t;
+
+static eval_cache_t eval_caches[MAX_WORKERS];
+static volatile uint32_t eval_cache_generation = 1;
+
+void eval_cache_clear() {
+  __sync_fetch_and_add(&eval_cache_generation, 1);
+}
+
+void eval_cache_reset_stats() {
+  for (int i = 0; i < MAX_WORKERS; i++) {
+    eval_caches[i].probes = 0;
+    eval_caches[i].hits = 0;
+  }
+}
+
+void eval_cache_stats(uint64_t *probes, uint64_t *hits) {
+  *probes = 0;
+  *hits = 0;
+  for (int i = 0; i < MAX_WORKERS; i++) {
+    *probes += eval_caches[i].probes;
+    *hits += eval_caches[i].hits;
+  }
+}
+
+// Returns the calling worker's cache, (re)built for the current generation,
+// or NULL if it has none.
+static eval_cache_t *get_eval_cache() {
+  eval_cache_t *c = &eval_caches[sched_worker_id()];
+  if (c->generation != eval_cache_generation) {
+    c->generation = eval_cache_generation;
+    free(c->entries);
+    c->entries = NULL;
+    uint64_t num_entries = (uint64_t) EVAL_CACHE * 1024 / sizeof(uint64_t);
+    if (num_entries > 0) {
+      // round down to a power of 2
+      while (num_entries & (num_entries - 1)) {
+        num_entries &= num_entries - 1;
+      }
+      c->entries = calloc(num_entries, sizeof(uint64_t));
+      c->mask = num_entries - 1;
+    }
+  }
+  return c->entries ? c : NULL;
+}
+
+// eval(p, li, false) through the calling thread's eval cache.  RANDOMIZE
+// makes every call to eval() different, so the cache is bypassed then.
+score_t cached_eval(position_t *p, const laser_info_t *li) {
+  if (RANDOMIZE) {
+    return eval(p, li, false);
+  }
+  eval_cache_t *c = get_eval_cache();
+  if (c == NULL) {
+    return eval(p, li, false);
+  }
+
+  c->probes++;
+  uint64_t *e = &c->entries[p->key & c->mask];
+  if (*e != 0 && ((*e ^ p->key) & ~EVAL_CACHE_SCORE_MASK) == 0) {
+    c->hits++;
+    return (score_t) (*e & EVAL_CACHE_SCORE_MASK);
+  }
+
+  const score_t score = eval(p, li, false);
+  *e = (p->key & ~EVAL_CACHE_SCORE_MASK) | (uint16_t) score;
+  return score;
+}
@@ -11,6 +11,17 @@
 
 // ev_score_t values
 #define PAWN_EV_VALUE (PAWN_VALUE*EV_SCORE_RATIO)
-bool use_precomp;
-score_t eval(position_t *p, bool verbose);
+score_t eval(position_t *p, const laser_info_t *li, bool verbose);
+void get_laser_info(position_t *p, laser_info_t *li);
+void init_eval_sums(position_t *p);
+void update_eval_kings(position_t *p);
+void update_eval_pawn_moved(position_t *p, color_t c, square_t from_sq,
+                            square_t to_sq);
+void update_eval_pawn_removed(position_t *p, color_t c, square_t sq);
+
+// per-thread cache of static scores
+score_t cached_eval(position_t *p, const laser_info_t *li);
+void eval_cache_clear();
+void eval_cache_reset_stats();
+void eval_cache_stats(uint64_t *probes, uint64_t *hits);
 #endif  // EVAL_H
@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 
+#include "./eval.h"
 #include "./move_gen.h"
 #include "./tbassert.h"
 
@@ -18,6 +19,16 @@ static void fen_error(char *fen, int c_count, char *msg) {
   fprintf(stderr, "%s\n", msg);
 }
 
+// puts a piece of the given type, color and orientation on square sq
+static void place_piece(position_t *p, square_t sq, ptype_t typ, color_t c,
+                        int ori) {
+  piece_t x = 0;
+  set_ptype(&x, typ);
+  set_color(&x, c);
+  set_ori(&x, ori);
+  set_piece(p, sq, x);
+}
+
 // parse_fen_board
 // Input:   board representation as a fen string
 //          unpopulated board position struct
@@ -70,7 +81,7 @@ static int parse_fen_board(position_t *p, char *fen) {
             fen_error(fen, c_count, "Too many squares in rank.\n");
             return 0;
           }
-          set_ptype(&p->board[square_of(f, r)], EMPTY);
+          set_piece(p, square_of(f, r), EMPTY);
           c--;
         }
         break;
@@ -96,9 +107,7 @@ static int parse_fen_board(position_t *p, char *fen) {
           fen_error(fen, c_count+1, "Syntax error");
           return 0;
         }
-        set_ptype(&p->board[square_of(f, r)], typ);
-        set_color(&p->board[square_of(f, r)], WHITE);
-        set_ori(&p->board[square_of(f, r)], ori);
+        place_piece(p, square_of(f, r), typ, WHITE, ori);
         break;
 
       case 'n':
@@ -121,9 +130,7 @@ static int parse_fen_board(position_t *p, char *fen) {
           fen_error(fen, c_count+1, "Syntax error");
           return 0;
         }
-        set_ptype(&p->board[square_of(f, r)], typ);
-        set_color(&p->board[square_of(f, r)], BLACK);
-        set_ori(&p->board[square_of(f, r)], ori);
+        place_piece(p, square_of(f, r), typ, BLACK, ori);
         break;
 
       case 'S':
@@ -146,9 +153,7 @@ static int parse_fen_board(position_t *p, char *fen) {
           fen_error(fen, c_count+1, "Syntax error");
           return 0;
         }
-        set_ptype(&p->board[square_of(f, r)], typ);
-        set_color(&p->board[square_of(f, r)], WHITE);
-        set_ori(&p->board[square_of(f, r)], ori);
+        place_piece(p, square_of(f, r), typ, WHITE, ori);
         break;
 
       case 's':
@@ -171,9 +176,7 @@ static int parse_fen_board(position_t *p, char *fen) {
           fen_error(fen, c_count+1, "Syntax error");
           return 0;
         }
-        set_ptype(&p->board[square_of(f, r)], typ);
-        set_color(&p->board[square_of(f, r)], BLACK);
-        set_ori(&p->board[square_of(f, r)], ori);
+        place_piece(p, square_of(f, r), typ, BLACK, ori);
         break;
 
       case 'E':
@@ -184,9 +187,7 @@ static int parse_fen_board(position_t *p, char *fen) {
         next_c = fen[c_count++];
 
         if (next_c == 'E') {  // White King facing East
-          set_ptype(&p->board[square_of(f, r)], KING);
-          set_color(&p->board[square_of(f, r)], WHITE);
-          set_ori(&p->board[square_of(f, r)], EE);
+          place_piece(p, square_of(f, r), KING, WHITE, EE);
         } else {
           fen_error(fen, c_count+1, "Syntax error");
           return 0;
@@ -201,9 +202,7 @@ static int parse_fen_board(position_t *p, char *fen) {
         next_c = fen[c_count++];
 
         if (next_c == 'W') {  // White King facing West
-          set_ptype(&p->board[square_of(f, r)], KING);
-          set_color(&p->board[square_of(f, r)], WHITE);
-          set_ori(&p->board[square_of(f, r)], WW);
+          place_piece(p, square_of(f, r), KING, WHITE, WW);
         } else {
           fen_error(fen, c_count+1, "Syntax error");
           return 0;
@@ -218,9 +217,7 @@ static int parse_fen_board(position_t *p, char *fen) {
         next_c = fen[c_count++];
 
         if (next_c == 'e') {  // Black King facing East
-          set_ptype(&p->board[square_of(f, r)], KING);
-          set_color(&p->board[square_of(f, r)], BLACK);
-          set_ori(&p->board[square_of(f, r)], EE);
+          place_piece(p, square_of(f, r), KING, BLACK, EE);
         } else {
           fen_error(fen, c_count+1, "Syntax error");
           return 0;
@@ -235,9 +232,7 @@ static int parse_fen_board(position_t *p, char *fen) {
         next_c = fen[c_count++];
 
         if (next_c == 'w') {  // Black King facing West
-          set_ptype(&p->board[square_of(f, r)], KING);
-          set_color(&p->board[square_of(f, r)], BLACK);
-          set_ori(&p->board[square_of(f, r)], WW);
+          place_piece(p, square_of(f, r), KING, BLACK, WW);
         } else {
           fen_error(fen, c_count+1, "Syntax error");
           return 0;
@@ -314,7 +309,7 @@ static int get_sq_from_str(char *fen, int *c_count, int *sq) {
 // Translate a fen string into a board position struct
 //
 int fen_to_pos(position_t *p, char *fen) {
-  static  position_t dmy1, dmy2;
+  static  undo_t dmy1, dmy2;
 
   // these sentinels simplify checking previous
   // states without stepping past null pointers.
@@ -341,19 +336,19 @@ int fen_to_pos(position_t *p, char *fen) {
 
   int c_count = 0;  // Invariant: fen[c_count] is next char to be read
 
-  for (int i = 0; i < ARR_SIZE; ++i) {
-    set_ptype(&p->board[i], INVALID);  // squares are invalid until filled
-  }
+  clear_board(p);  // squares are invalid until filled
 
   c_count = parse_fen_board(p, fen);
   if (!c_count) {
     return 1;  // parse error of board
   }
+#if !BITBOARD
   for(int c = 0; c < 2; c++) {
     for(int loc = 0; loc < NUMBER_PAWNS; loc++) {
       p->plocs[c][loc] = 0;
     }
   }
+#endif
   // King check
 
   int Kings[2] = {0, 0};
@@ -361,13 +356,15 @@ int fen_to_pos(position_t *p, char *fen) {
   for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
     for (rnk_t r = 0; r < BOARD_WIDTH; ++r) {
       square_t sq = square_of(f, r);
-      piece_t x = p->board[sq];
+      piece_t x = piece_at(p, sq);
       ptype_t typ = ptype_of(x);
       if (typ == KING) {
         Kings[color_of(x)]++;
         p->kloc[color_of(x)] = sq;
       } else if(typ == PAWN) {
+#if !BITBOARD
         p->plocs[color_of(x)][Pawns[color_of(x)]] = sq;
+#endif
         Pawns[color_of(x)] ++;
       }
     }
@@ -428,6 +425,8 @@ int fen_to_pos(position_t *p, char *fen) {
   if (lm_from_sq == 0) {   // from-square of last move
     p->last_move = 0;  // no last move specified
     p->key = compute_zob_key(p);
+    init_laser_paths(p);
+    init_eval_sums(p);
     return 0;
   }
 
@@ -459,6 +458,8 @@ int fen_to_pos(position_t *p, char *fen) {
   }
   p->last_move = move_of(EMPTY, lm_rot, lm_from_sq, lm_to_sq);
   p->key = compute_zob_key(p);
+  init_laser_paths(p);
+  init_eval_sums(p);
 
   return 0;  // everything is okay
 }
@@ -483,31 +484,32 @@ int pos_to_fen(position_t *p, char *fen) {
   int pos = 0;
   int i;
 
-  for (rnk_t r = BOARD_WIDTH - 1; r >=0 ; --r) {
+  for (int r = BOARD_WIDTH - 1; r >= 0; --r) {
     int empty_in_a_row = 0;
     for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
       square_t sq = square_of(f, r);
+      const piece_t x = piece_at(p, sq);
 
-      if (ptype_of(p->board[sq]) == INVALID) {     // invalid square
+      if (ptype_of(x) == INVALID) {     // invalid square
         tbassert(false, "Bad news, yo.\n");        // This is bad!
       }
 
-      if (ptype_of(p->board[sq]) == EMPTY) {       // empty square
+      if (ptype_of(x) == EMPTY) {       // empty square
         empty_in_a_row++;
         continue;
       } else {
         if (empty_in_a_row) fen[pos++] = '0' + empty_in_a_row;
         empty_in_a_row = 0;
 
-        int ori = ori_of(p->board[sq]);  // orientation
-        color_t c = color_of(p->board[sq]);
+        int ori = ori_of(x);  // orientation
+        color_t c = color_of(x);
 
-        if (ptype_of(p->board[sq]) == KING) {
+        if (ptype_of(x) == KING) {
           for (i = 0; i < 2; i++) fen[pos++] = king_ori_to_rep[c][ori][i];
           continue;
         }
 
-        if (ptype_of(p->board[sq]) == PAWN) {
+        if (ptype_of(x) == PAWN) {
           for (i = 0; i < 2; i++) fen[pos++] = pawn_ori_to_rep[c][ori][i];
           continue;
         }
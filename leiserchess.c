@@ -12,28 +12,22 @@
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 
-#if PARALLEL
-#include <cilk/cilk.h>
-#include <cilk/reducer.h>
-#endif
-
 #include "./eval.h"
 #include "./fen.h"
 #include "./move_gen.h"
+#include "./scheduler.h"
 #include "./search.h"
 #include "./tbassert.h"
+#include "./time_man.h"
 #include "./tt.h"
 #include "./util.h"
 
 char  VERSION[] = "1038";
 
 #define MAX_HASH 4096       // 4 GB
-#define INF_TIME 99999999999.0
+#define MAX_EVAL_CACHE 65536  // 64 MB per thread
 #define INF_DEPTH 999       // if user does not specify a depth, use 999
 
-// if the time remain is less than this fraction, dont start the next search iteration
-#define RATIO_FOR_TIMEOUT 0.5
-
 // -----------------------------------------------------------------------------
 // file I/O
 // -----------------------------------------------------------------------------
@@ -52,6 +46,10 @@ extern int USE_NMM;
 extern int FUT_DEPTH;
 extern int TRACE_MOVES;
 extern int DETECT_DRAWS;
+extern int THREADS;
+extern int LAZY_SMP;
+extern int MERGE_HISTORY;
+extern int WORKER_STATS;
 
 // defined in eval.c
 extern int RANDOMIZE;
@@ -62,6 +60,7 @@ extern int KFACE;
 extern int KAGGRESSIVE;
 extern int MOBILITY;
 extern int PAWNPIN;
+extern int EVAL_CACHE;
 
 // defined in move_gen.c
 extern int USE_KO;
@@ -96,6 +95,10 @@ static int_options iopts[] = {
   { "pbetween",               &PBETWEEN,   0.3 * PAWN_EV_VALUE,   -PAWN_EV_VALUE, PAWN_EV_VALUE },
   { "pcentral",               &PCENTRAL,   0.1 * PAWN_EV_VALUE,   -PAWN_EV_VALUE, PAWN_EV_VALUE },
   { "hash",                       &HASH,   16,                    1,              MAX_HASH   },
+  { "evalcache",            &EVAL_CACHE,   256,                   0,              MAX_EVAL_CACHE },
+  { "threads",                 &THREADS,   1,                     1,              MAX_WORKERS   },
+  { "lazysmp",                &LAZY_SMP,   0,                     0,              1             },
+  { "mergehistory",      &MERGE_HISTORY,   1,                     0,              1             },
   { "draw",                       &DRAW,   -0.07 * PAWN_VALUE,    -PAWN_VALUE,    PAWN_VALUE    },
   { "randomize",             &RANDOMIZE,   0,                     0,              PAWN_EV_VALUE },
   { "lmr_r1",                   &LMR_R1,   5,                     1,              MAX_NUM_MOVES },
@@ -108,6 +111,7 @@ static int_options iopts[] = {
   { "use_tt",                   &USE_TT,   1,                     0,              1             },
   { "use_ko",                   &USE_KO,   1,                     0,              1             },
   { "trace_moves",         &TRACE_MOVES,   0,                     0,              1             },
+  { "workerstats",        &WORKER_STATS,   0,                     0,              1             },
   { "",                            NULL,   0,                     0,              0             }
 };
 
@@ -128,14 +132,14 @@ void lower_case(char *s) {
 }
 
 // Returns victims or NO_VICTIMS if no victims or -1 if illegal move
-// makes the move described by 'mvstring'
-victims_t make_from_string(position_t *old, position_t *p,
-                           const char *mvstring) {
+// makes the move described by 'mvstring' in place, saving its undo record
+// in u.  p is left unchanged if the move is illegal or Ko.
+victims_t make_from_string(position_t *p, undo_t *u, const char *mvstring) {
   sortable_move_t lst[MAX_NUM_MOVES];
   move_t mv = 0;
   // make copy so that mvstring can be a constant
   char string[MAX_CHARS_IN_MOVE];
-  int move_count = generate_all(old, lst, true);
+  int move_count = generate_all(p, lst, true, NULL);
 
   snprintf(string, MAX_CHARS_IN_MOVE, "%s", mvstring);
   lower_case(string);
@@ -151,7 +155,31 @@ victims_t make_from_string(position_t *old, position_t *p,
     }
   }
 
-  return (mv == 0) ? ILLEGAL() : make_move(old, p, mv);
+  if (mv == 0) {
+    return ILLEGAL();
+  }
+  victims_t victims = do_move(p, mv, u);
+  if (is_KO(victims)) {
+    undo_move(p, u);
+  }
+  return victims;
+}
+
+// The first move of p that is not Ko, or 0 if there is none.  A search that
+// is stopped before it scores a move plays this one.
+static move_t first_legal_move(position_t *p) {
+  sortable_move_t lst[MAX_NUM_MOVES];
+  int move_count = generate_all(p, lst, false, NULL);
+  for (int i = 0; i < move_count; i++) {
+    move_t mv = get_move(lst[i]);
+    undo_t u;
+    victims_t victims = do_move(p, mv, &u);
+    undo_move(p, &u);
+    if (!is_KO(victims)) {
+      return mv;
+    }
+  }
+  return 0;
 }
 
 typedef enum {
@@ -163,79 +191,402 @@ typedef enum {
 
 // -----------------------------------------------------------------------------
 // UCI search (top level scout search call)
+//
+// Searches run on their own thread, so that the input loop keeps reading
+// commands during a search: stop and ponderhit act on it, isready is
+// answered at once, and any other command waits until the search is over
+// (see wait_for_search).  After go infinite or go ponder, bestmove is only
+// printed once the GUI sends stop or ponderhit.
 // -----------------------------------------------------------------------------
 
 static move_t bestMoveSoFar;
 static char theMove[MAX_CHARS_IN_MOVE];
 
-static pthread_mutex_t entry_mutex;
-static uint64_t node_count_serial;
-
 typedef struct {
-  position_t *p;
+  position_t *p;  // not changed during the search, see wait_for_search
   int depth;
-  double tme;
+  timeLimits limits;
 } entry_point_args;
 
+static pthread_t search_thread;
+static bool search_thread_started = false;
+
+// search_mutex protects the search state below, and search_cond signals
+// every change to it.
+static pthread_mutex_t search_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t search_cond = PTHREAD_COND_INITIALIZER;
+static entry_point_args search_args;
+static bool search_requested = false;  // search_args are for a new search
+static bool searching = false;         // from go until bestmove is printed
+static bool waiting_for_stop = false;  // go infinite or go ponder
+static volatile bool pondering = false;  // go ponder, until ponderhit
+
 void *entry_point(void *arg) {
   move_t subpv[MAX_PLY_IN_SEARCH];
 
   entry_point_args *real_arg = (entry_point_args *) arg;
   int depth = real_arg->depth;
+  if (depth > MAX_PLY_IN_SEARCH - 1) {
+    depth = MAX_PLY_IN_SEARCH - 1;
+  }
   position_t *p = real_arg->p;
-  double tme = real_arg->tme;
 
   double et = 0.0;
 
-  // start time of search
-  init_abort_timer(tme);
+  // The clock and the stop flag were set by UciBeginSearch, so that a stop
+  // sent before we got here is not lost.
+  tm_start(&real_arg->limits);
 
   init_best_move_history();
   tt_age_hashtable();
 
-  init_tics();
+  bestMoveSoFar = first_legal_move(p);
+
+  if (LAZY_SMP) {
+    lazy_smp_start(p, depth);
+  }
 
   for (int d = 1; d <= depth; d++) {  // Iterative deepening
     reset_abort();
 
-    searchRoot(p, -INF, INF, d, 0, subpv, &node_count_serial,
-                OUT);
+    score_t score = searchRoot(p, -INF, INF, d, 0, subpv, OUT);
 
     et = elapsed_time();
-    bestMoveSoFar = subpv[0];
+    if (subpv[0] != 0) {  // else aborted before scoring a move
+      bestMoveSoFar = subpv[0];
+    }
 
-    if (!should_abort()) {
-      // print something?
-    } else {
+    if (should_abort()) {
       break;
     }
 
-    // don't start iteration that you cannot complete
-    if (et > tme * RATIO_FOR_TIMEOUT) break;
+    // don't start an iteration that we cannot complete
+    const bool next = tm_next_iteration(d, subpv[0], score, et);
+    if (!pondering && !next) {
+      break;
+    }
   }
 
-  // This unlock will allow the main thread lock/unlock in UCIBeginSearch to
-  // proceed
-  pthread_mutex_unlock(&entry_mutex);
+  double ms_late;
+  if (abort_timer_fired(&ms_late)) {
+    fprintf(OUT, "info string search stopped %.2f ms after the timeout\n", ms_late);
+  }
+
+  if (LAZY_SMP) {
+    uint64_t helper_nodes = lazy_smp_finish();
+    et = elapsed_time();
+    if (et < 0.00001) {
+      et = 0.00001;
+    }
+    uint64_t nodes = search_node_count();
+    fprintf(OUT, "info string lazy smp %d threads searched %" PRIu64
+            " nodes (%" PRIu64 " by helpers) nps %" PRIu64 "\n",
+            sched_num_workers(), nodes, helper_nodes,
+            (uint64_t) (1000 * nodes / et));
+  }
 
   return NULL;
 }
 
+// One line per worker, to show how evenly the search was spread.  A worker
+// that got no work in this search is left out.
+static void print_worker_stats() {
+  uint64_t total = search_node_count();
+  for (int i = 0; i < sched_num_workers(); i++) {
+    uint64_t nodes, qnodes, tt_hits;
+    if (!search_worker_stats(i, &nodes, &qnodes, &tt_hits)) {
+      continue;
+    }
+    fprintf(OUT, "info string worker %d nodes %" PRIu64 " (%.1f%%) qnodes %"
+            PRIu64 " tt hits %" PRIu64 "\n", i, nodes,
+            total ? 100.0 * nodes / total : 0.0, qnodes, tt_hits);
+  }
+}
+
 // Makes call to entry_point -> make call to searchRoot -> searchRoot in search.c
-void UciBeginSearch(position_t *p, int depth, double tme) {
-  pthread_mutex_lock(&entry_mutex);  // setup for the barrier
-  entry_point_args args;
-  args.depth = depth;
-  args.p = p;
-  args.tme = tme;
-  node_count_serial = 0;
-  entry_point(&args);
-
-  char bms[MAX_CHARS_IN_MOVE];
-  move_to_str(bestMoveSoFar, bms, MAX_CHARS_IN_MOVE);
-  snprintf(theMove, MAX_CHARS_IN_MOVE, "%s", bms);
-  fprintf(OUT, "bestmove %s\n", bms);
-  return;
+static void run_search(entry_point_args *args) {
+  eval_cache_reset_stats();
+  entry_point(args);
+
+  uint64_t probes, hits;
+  eval_cache_stats(&probes, &hits);
+  if (probes > 0) {
+    fprintf(OUT, "info string eval cache %" PRIu64 " hits of %" PRIu64
+            " probes (%.1f%%)\n", hits, probes, 100.0 * hits / probes);
+  }
+  uint64_t cutoffs, first_move_cutoffs;
+  search_cutoff_stats(&cutoffs, &first_move_cutoffs);
+  if (cutoffs > 0) {
+    fprintf(OUT, "info string first move cutoffs %" PRIu64 " of %" PRIu64
+            " (%.1f%%)\n", first_move_cutoffs, cutoffs,
+            100.0 * first_move_cutoffs / cutoffs);
+  }
+  if (WORKER_STATS) {
+    print_worker_stats();
+  }
+}
+
+static void *search_thread_main(void *arg) {
+  pthread_mutex_lock(&search_mutex);
+  while (true) {
+    while (!search_requested) {
+      pthread_cond_wait(&search_cond, &search_mutex);
+    }
+    search_requested = false;
+    pthread_mutex_unlock(&search_mutex);
+
+    run_search(&search_args);
+
+    pthread_mutex_lock(&search_mutex);
+    while (waiting_for_stop) {
+      pthread_cond_wait(&search_cond, &search_mutex);
+    }
+    char bms[MAX_CHARS_IN_MOVE];
+    move_to_str(bestMoveSoFar, bms, MAX_CHARS_IN_MOVE);
+    snprintf(theMove, MAX_CHARS_IN_MOVE, "%s", bms);
+    fprintf(OUT, "bestmove %s\n", bms);
+    searching = false;
+    pthread_cond_broadcast(&search_cond);
+  }
+  return NULL;
+}
+
+// Starts a search of p, and returns without waiting for it.  With infinite
+// or ponder, the search goes on until stop or ponderhit; a ponder search then
+// continues as a normal search within limits.
+void UciBeginSearch(position_t *p, int depth, const timeLimits *limits,
+                    bool infinite, bool ponder) {
+  pthread_mutex_lock(&search_mutex);
+  tbassert(!searching, "search already running\n");
+  if (!search_thread_started) {
+    if (pthread_create(&search_thread, NULL, search_thread_main, NULL) != 0) {
+      fprintf(stderr, "UciBeginSearch: could not start the search thread\n");
+      exit(1);
+    }
+    search_thread_started = true;
+  }
+  search_args.depth = depth;
+  search_args.p = p;
+  search_args.limits = *limits;
+  // Start the clock and clear the stop flag here rather than on the search
+  // thread, which may only get going after stop or ponderhit.  While
+  // pondering, the clock is not ours.
+  init_stop();
+  reset_abort();
+  init_abort_timer(ponder ? INF_TIME : tm_maximum_time(limits));
+  set_node_limit(limits->nodes);
+  waiting_for_stop = infinite || ponder;
+  pondering = ponder;
+  searching = true;
+  search_requested = true;
+  pthread_cond_broadcast(&search_cond);
+  pthread_mutex_unlock(&search_mutex);
+}
+
+// Ends the search in progress, if any, as soon as possible.
+void UciStopSearch() {
+  pthread_mutex_lock(&search_mutex);
+  if (searching) {
+    waiting_for_stop = false;
+    pondering = false;
+    stop_search();
+    pthread_cond_broadcast(&search_cond);
+  }
+  pthread_mutex_unlock(&search_mutex);
+}
+
+// The opponent played the move we were pondering on: from now on, search
+// within the limits given to go ponder.
+void UciPonderHit() {
+  pthread_mutex_lock(&search_mutex);
+  if (searching && pondering) {
+    init_abort_timer(tm_maximum_time(&search_args.limits));
+    pondering = false;
+    waiting_for_stop = false;
+    pthread_cond_broadcast(&search_cond);
+  }
+  pthread_mutex_unlock(&search_mutex);
+}
+
+// Waits until the search in progress, if any, has printed bestmove.  A
+// search that would only end on stop is stopped.
+static void wait_for_search() {
+  pthread_mutex_lock(&search_mutex);
+  if (searching && waiting_for_stop) {
+    waiting_for_stop = false;
+    pondering = false;
+    stop_search();
+    pthread_cond_broadcast(&search_cond);
+  }
+  while (searching) {
+    pthread_cond_wait(&search_cond, &search_mutex);
+  }
+  pthread_mutex_unlock(&search_mutex);
+}
+
+// Searches p to depth with 1, 2, ..., max_workers workers, each time from an
+// empty transposition table, and reports the time to depth and the speedup
+// over one worker.  The searches print nothing else.
+void speedup(position_t *p, int depth, int max_workers) {
+  double base_time = 0.0;
+
+  for (int n = 1; n <= max_workers; n++) {
+    sched_set_workers(n);
+    tt_clear_hashtable();
+    eval_cache_clear();
+    init_best_move_history();
+    clear_killers();
+    init_abort_timer(INF_TIME);
+    init_stop();
+    set_node_limit(0);
+
+    move_t pv[MAX_PLY_IN_SEARCH];
+    double start = milliseconds();
+    if (LAZY_SMP) {
+      lazy_smp_start(p, depth);
+    }
+    for (int d = 1; d <= depth; d++) {
+      reset_abort();
+      searchRoot(p, -INF, INF, d, 0, pv, NULL);
+    }
+    if (LAZY_SMP) {
+      lazy_smp_finish();
+    }
+    uint64_t nodes = search_node_count();
+    double et = milliseconds() - start;
+    if (et < 0.00001) {
+      et = 0.00001;
+    }
+    if (n == 1) {
+      base_time = et;
+    }
+
+    uint64_t cutoffs, first_move_cutoffs;
+    search_cutoff_stats(&cutoffs, &first_move_cutoffs);
+
+    char bms[MAX_CHARS_IN_MOVE];
+    move_to_str(pv[0], bms, MAX_CHARS_IN_MOVE);
+    fprintf(OUT, "info string speedup workers %d depth %d time %d nodes %" PRIu64
+            " nps %" PRIu64 " speedup %.2f first move cutoffs %.1f%% bestmove %s\n",
+            n, depth, (int) et, nodes, (uint64_t) (1000 * nodes / et),
+            base_time / et, cutoffs ? 100.0 * first_move_cutoffs / cutoffs : 0.0,
+            bms);
+  }
+
+  sched_set_workers(THREADS);
+}
+
+// Identifies this build's Zobrist keys in hash table files: the key of the
+// starting position.
+static uint64_t zob_id() {
+  position_t start;
+  fen_to_pos(&start, "");
+  return start.key;
+}
+
+// State of a ttstress run.  Each key gets its own move and score, so a record
+// read back for key can be checked against it.
+typedef struct ttStress {
+  uint64_t ops_per_task;
+  uint64_t hits;  // records found
+  uint64_t bad;   // records found that belong to another key
+} ttStress;
+
+static move_t stress_move(uint64_t key) {
+  return (key >> 8) & MOVE_MASK;
+}
+
+static score_t stress_score(uint64_t key) {
+  return (score_t) ((key >> 32) % 20001) - 10000;
+}
+
+static uint64_t stress_rand(uint64_t *state) {  // splitmix64
+  uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+static void tt_stress_task(void *arg, int task) {
+  ttStress *stress = (ttStress *) arg;
+  uint64_t state = task;
+  uint64_t hits = 0;
+  uint64_t bad = 0;
+  for (uint64_t n = 0; n < stress->ops_per_task; n++) {
+    const uint64_t r = stress_rand(&state);
+    // 256 keys in 16 sets of the table (of up to 2^28 sets), so that
+    // writers keep colliding
+    uint64_t seed = r & 0xff;
+    const uint64_t h = stress_rand(&seed);
+    const uint64_t key = (h << 28) | (h >> 60);
+    if (r & (1ULL << 63)) {
+      tt_hashtable_put(key, (r >> 40) % 64, stress_score(key),
+                       (r >> 48) & 1 ? LOWER : UPPER, stress_move(key));
+    } else {
+      ttRec_t *rec = tt_hashtable_get(key);
+      if (rec != NULL) {
+        hits++;
+        if (tt_move_of(rec) != stress_move(key) ||
+            tt_score_of(rec) != stress_score(key)) {
+          bad++;
+        }
+      }
+    }
+  }
+  __sync_fetch_and_add(&stress->hits, hits);
+  __sync_fetch_and_add(&stress->bad, bad);
+}
+
+// Puts and gets records for a few colliding keys from num_workers workers at
+// once, and reports how many of the records read back were wrong.  Clears
+// the transposition table.
+void tt_stress(int num_workers, uint64_t ops) {
+  const int num_tasks = 8 * num_workers;
+  ttStress stress = { .ops_per_task = ops / num_tasks, .hits = 0, .bad = 0 };
+  const int use_tt = USE_TT;
+
+  sched_set_workers(num_workers);
+  USE_TT = 1;
+  tt_clear_hashtable();
+  double start = milliseconds();
+  sched_parallel_for(0, num_tasks, tt_stress_task, &stress);
+  double et = milliseconds() - start;
+  tt_clear_hashtable();
+  USE_TT = use_tt;
+  sched_set_workers(THREADS);
+
+  fprintf(OUT, "info string ttstress workers %d ops %" PRIu64 " time %d"
+          " hits %" PRIu64 " bad %" PRIu64 "\n",
+          num_workers, stress.ops_per_task * num_tasks, (int) et,
+          stress.hits, stress.bad);
+}
+
+#define HASH_BENCH_PROBES 10000000
+
+// Sets up a table of each of the num_sizes sizes, and reports how long that
+// takes and the average time of a probe for a random key.  Leaves an empty
+// table of HASH megabytes.
+void hash_benchmark(const int *sizes_in_meg, int num_sizes) {
+  const int use_tt = USE_TT;
+  USE_TT = 1;
+  for (int i = 0; i < num_sizes; i++) {
+    double start = milliseconds();
+    tt_resize_hashtable(sizes_in_meg[i]);
+    const double startup = milliseconds() - start;
+
+    uint64_t state = 1;
+    start = milliseconds();
+    for (int n = 0; n < HASH_BENCH_PROBES; n++) {
+      tt_hashtable_get(stress_rand(&state));
+    }
+    const double probe_ns = (milliseconds() - start) * 1e6 / HASH_BENCH_PROBES;
+
+    fprintf(OUT, "info string hashbench hash %d MB pages %s startup %d ms"
+            " probe %.1f ns\n", sizes_in_meg[i], tt_get_page_kind(),
+            (int) startup, probe_ns);
+  }
+  USE_TT = use_tt;
+  tt_resize_hashtable(HASH);
 }
 
 // -----------------------------------------------------------------------------
@@ -252,10 +603,25 @@ void help()  {
   printf("            time <time_limit>: search assume you have <time> amount of time\n");
   printf("                               for the whole game.\n");
   printf("            inc <time_inc>:    set the fischer time increment for the search\n");
-  printf("            Both time arguments are specified in milliseconds.\n");
+  printf("            movestogo <moves>: moves until the next time control\n");
+  printf("            movetime <time>:   search for exactly <time>\n");
+  printf("            All time arguments are specified in milliseconds.\n");
+  printf("            nodes <nodes>:     stop after about <nodes> nodes\n");
+  printf("            infinite:          search until stop; also the default\n");
+  printf("                               when no limit is given\n");
+  printf("            ponder:            search on the opponent's time until stop\n");
+  printf("                               or ponderhit\n");
+  printf("            The search runs in the background; see stop and ponderhit.\n");
   printf("            Sample usage: \n");
   printf("                go depth 4: search until depth 4\n");
+  printf("hashbench - Report the set-up time and the time per probe of hash tables\n");
+  printf("            of the given sizes in MB.\n");
+  printf("            Sample usage: \n");
+  printf("                hashbench 16 256 1024\n");
   printf("help      - Display help (this info).\n");
+  printf("loadhash  - Replace the hash table with one saved by savehash.\n");
+  printf("            Sample usage: \n");
+  printf("                loadhash opening.hash\n");
   printf("isready   - Ask if the UCI engine is ready, if so it echoes \"readyok\".\n");
   printf("            This is mainly used to synchronize the engine with the GUI.\n");
   printf("move      - Make a move for current player.\n");
@@ -265,6 +631,8 @@ void help()  {
   printf("            Used to verify move the generator.\n");
   printf("            Sample usage: \n");
   printf("                depth 3: generate all possible moves for depth 1--3\n");
+  printf("ponderhit - The opponent made the expected move: go on with the go ponder\n");
+  printf("            search as a normal search with the time given to it.\n");
   printf("position  - Set up the board using the fenstring given.  Possible arguments are:\n");
   printf("            startpos:     set up the board with default starting position.\n");
   printf("            endgame:      set up the board with endgame configuration.\n");
@@ -273,11 +641,21 @@ void help()  {
   printf("            Sample usage: \n");
   printf("                position endgame: set up the board so that only kings remain\n");
   printf("quit      - Quit this program\n");
+  printf("savehash  - Save the hash table to a file, for loadhash.\n");
+  printf("            Sample usage: \n");
+  printf("                savehash opening.hash\n");
   printf("setoption - Set configuration options used in the engine, the format is: \n");
   printf("            setoption name <name> value <val>.\n");
   printf("            Use the comment \"uci\" to see possible options and their current values\n");
   printf("            Sample usage: \n");
   printf("                setoption name fut_depth value 4: set fut_depth to 4\n");
+  printf("speedup   - Report the time to a given depth with 1, 2, ... workers.\n");
+  printf("            Sample usage: \n");
+  printf("                speedup 7 8: search to depth 7 with 1 to 8 workers\n");
+  printf("stop      - Stop the search and print bestmove.\n");
+  printf("ttstress  - Test the transposition table with many workers at once.\n");
+  printf("            Sample usage: \n");
+  printf("                ttstress 8 100: 100 million puts and gets by 8 workers\n");
   printf("uci       - Display UCI version and options\n");
   printf("\n");
 }
@@ -395,7 +773,8 @@ void print_options() {
 // -----------------------------------------------------------------------------
 
 int main(int argc, char *argv[]) {
-  position_t *gme = (position_t *) malloc(sizeof(position_t) * MAX_PLY_IN_GAME);
+  position_t gme;  // the game position; moves are made on it in place
+  undo_t *undo = (undo_t *) malloc(sizeof(undo_t) * MAX_PLY_IN_GAME);
 
   setbuf(stdout, NULL);
   setbuf(stdin, NULL);
@@ -409,9 +788,11 @@ int main(int argc, char *argv[]) {
 
   init_options();
   init_zob();
+  init_bitboards();
+  sched_set_workers(THREADS);
 
   char **tok = (char **) malloc(sizeof(char *) * MAX_CHARS_IN_TOKEN * MAX_PLY_IN_GAME);
-  int   ix = 0;  // index of which position we are operating on
+  int   ix = 0;  // number of moves made since the last fen
 
   // input string - last message from UCI interface
   // big enough to support 4000 moves
@@ -419,7 +800,7 @@ int main(int argc, char *argv[]) {
 
   
   tt_make_hashtable(HASH);   // initial hash table
-  fen_to_pos(&gme[ix], "");  // initialize with an actual position
+  fen_to_pos(&gme, "");  // initialize with an actual position
 
   //  Check to make sure we don't loop infinitely if we don't get input.
   bool saw_input = false;
@@ -441,6 +822,19 @@ int main(int argc, char *argv[]) {
         saw_input = true;
       }
 
+      // Only these act on a search in progress; see UciBeginSearch
+      if (strcmp(tok[0], "stop") == 0) {
+        UciStopSearch();
+        continue;
+      }
+      if (strcmp(tok[0], "ponderhit") == 0) {
+        UciPonderHit();
+        continue;
+      }
+      if (strcmp(tok[0], "isready") != 0) {
+        wait_for_search();
+      }
+
       if (strcmp(tok[0], "quit") == 0) {
         break;
       }
@@ -454,14 +848,14 @@ int main(int argc, char *argv[]) {
 
         if (strcmp(tok[1], "startpos") == 0) {
           ix = 0;
-          fen_to_pos(&gme[ix], "");
+          fen_to_pos(&gme, "");
           n = 2;
         } else if (strcmp(tok[1], "endgame") == 0) {
           ix = 0;
           if (BOARD_WIDTH == 10)
-            fen_to_pos(&gme[ix], "ss9/10/10/10/10/10/10/10/10/9NN W");
+            fen_to_pos(&gme, "ss9/10/10/10/10/10/10/10/10/9NN W");
           else if (BOARD_WIDTH == 8)
-            fen_to_pos(&gme[ix], "ss7/8/8/8/8/8/8/7NN W");
+            fen_to_pos(&gme, "ss7/8/8/8/8/8/8/7NN W");
           n = 2;
         } else if (strcmp(tok[1], "fen") == 0) {
           if (token_count < 3) {  // no input
@@ -469,17 +863,19 @@ int main(int argc, char *argv[]) {
             continue;
           }
           ix = 0;
-          fen_to_pos(&gme[ix], tok[2]);
+          fen_to_pos(&gme, tok[2]);
           n = 3;
         }
 
         int save_ix = ix;
         if (token_count > n+1) {
           for (int j = n + 1; j < token_count; j++) {
-            victims_t victims = make_from_string(&gme[ix], &gme[ix+1], tok[j]);
+            victims_t victims = make_from_string(&gme, &undo[ix], tok[j]);
             if (is_ILLEGAL(victims)) {
               fprintf(OUT, "info string Move %s is illegal\n", tok[j]);
-              ix = save_ix;
+              while (ix > save_ix) {
+                undo_move(&gme, &undo[--ix]);
+              }
               // breaks multiple loops.
               goto next_command;
             } else {
@@ -493,16 +889,16 @@ int main(int argc, char *argv[]) {
       }
 
       if (strcmp(tok[0], "move") == 0) {
-        victims_t victims = make_from_string(&gme[ix], &gme[ix+1], tok[1]);
         if (token_count < 2) {  // no input
           fprintf(OUT, "Second argument (move positon) required.\n");
           continue;
         }
+        victims_t victims = make_from_string(&gme, &undo[ix], tok[1]);
         if (is_KO(victims)) {
           fprintf(OUT, "Illegal move %s\n", tok[1]);
         } else {
           ix++;
-          display(&gme[ix]);
+          display(&gme);
         }
         continue;
       }
@@ -581,14 +977,22 @@ int main(int argc, char *argv[]) {
               }
               printf("info setting %s to %d\n", iopts[j].name, v);
               *(iopts[j].var) = v;
+              init_eval_sums(&gme);  // the weights may have changed
+              eval_cache_clear();
 
               if (strcmp(name+1, "hash") == 0) {
+                double start = milliseconds();
                 tt_resize_hashtable(HASH);
                 printf("info string Hash table set to %d records of "
                        "%zu bytes each\n",
                        tt_get_num_of_records(), tt_get_bytes_per_record());
-                printf("info string Total hash table size: %zu bytes\n",
-                       tt_get_num_of_records() * tt_get_bytes_per_record());
+                printf("info string Total hash table size: %zu bytes, "
+                       "in %s pages, set up in %d ms\n",
+                       tt_get_num_of_records() * tt_get_bytes_per_record(),
+                       tt_get_page_kind(), (int) (milliseconds() - start));
+              }
+              if (strcmp(name+1, "threads") == 0) {
+                sched_set_workers(THREADS);
               }
               break;
             }
@@ -606,13 +1010,13 @@ int main(int argc, char *argv[]) {
       }
 
       if (strcmp(tok[0], "display") == 0) {
-        display(&gme[ix]);
+        display(&gme);
         continue;
       }
 
       sortable_move_t  lst[MAX_NUM_MOVES];
       if (strcmp(tok[0], "generate") == 0) {
-        int num_moves = generate_all(&gme[ix], lst, true);
+        int num_moves = generate_all(&gme, lst, true, NULL);
         for (int i = 0; i < num_moves; ++i) {
           char buf[MAX_CHARS_IN_MOVE];
           move_to_str(get_move(lst[i]), buf, MAX_CHARS_IN_MOVE);
@@ -624,26 +1028,27 @@ int main(int argc, char *argv[]) {
 
       if (strcmp(tok[0], "eval") == 0) {
         if (token_count == 1) {  // evaluate current position
-          score_t score = eval(&gme[ix], true);
+          score_t score = eval(&gme, NULL, true);
           fprintf(OUT, "info score cp %d\n", score);
         } else {  // get and evaluate move
-          victims_t victims = make_from_string(&gme[ix], &gme[ix+1], tok[1]);
+          victims_t victims = make_from_string(&gme, &undo[ix], tok[1]);
           if (is_KO(victims)) {
             printf("Illegal move\n");
           } else {
             // evaluated from opponent's pov
-            score_t score = - eval(&gme[ix+1], true);
+            score_t score = - eval(&gme, NULL, true);
             fprintf(OUT, "info score cp %d\n", score);
+            undo_move(&gme, &undo[ix]);
           }
         }
         continue;
       }
 
       if (strcmp(tok[0], "go") == 0) {
-        double tme = 0.0;
-        double inc = 0.0;
+        timeLimits limits = { 0 };
         int    depth = INF_DEPTH;
-        double goal = INF_TIME;
+        bool   infinite = false;
+        bool   ponder = false;
 
         // process various tokens here
         for (int n = 1; n < token_count; n++) {
@@ -654,41 +1059,147 @@ int main(int argc, char *argv[]) {
           }
           if (strcmp(tok[n], "time") == 0) {
             n++;
-            tme = strtod(tok[n], (char **)NULL);
+            limits.time = strtod(tok[n], (char **)NULL);
             continue;
           }
           if (strcmp(tok[n], "inc") == 0) {
             n++;
-            inc = strtod(tok[n], (char **)NULL);
+            limits.inc = strtod(tok[n], (char **)NULL);
+            continue;
+          }
+          if (strcmp(tok[n], "movestogo") == 0) {
+            n++;
+            limits.movestogo = strtol(tok[n], (char **)NULL, 10);
+            continue;
+          }
+          if (strcmp(tok[n], "movetime") == 0) {
+            n++;
+            limits.movetime = strtod(tok[n], (char **)NULL);
+            continue;
+          }
+          if (strcmp(tok[n], "nodes") == 0) {
+            n++;
+            limits.nodes = strtoull(tok[n], (char **)NULL, 10);
             continue;
           }
+          if (strcmp(tok[n], "infinite") == 0) {
+            infinite = true;
+            continue;
+          }
+          if (strcmp(tok[n], "ponder") == 0) {
+            ponder = true;
+            continue;
+          }
+        }
+
+        if (depth == INF_DEPTH && !tm_timed(&limits) && limits.nodes == 0) {
+          infinite = true;  // nothing else would end the search
+        }
+        if (infinite) {
+          // only stop ends the search
+          limits = (timeLimits) { 0 };
+          ponder = false;
         }
+        UciBeginSearch(&gme, depth, &limits, infinite, ponder);
+        continue;
+      }
 
-        if (depth < INF_DEPTH) {
-          UciBeginSearch(&gme[ix], depth, INF_TIME);
+      if (strcmp(tok[0], "speedup") == 0) {
+        int depth = 6;
+        int max_workers = THREADS;
+        if (token_count >= 2) {
+          depth = strtol(tok[1], (char **)NULL, 10);
+        }
+        if (token_count >= 3) {
+          max_workers = strtol(tok[2], (char **)NULL, 10);
+        }
+        if (depth < 1) {
+          depth = 1;
+        }
+        if (depth > MAX_PLY_IN_SEARCH - 1) {
+          depth = MAX_PLY_IN_SEARCH - 1;
+        }
+        if (max_workers > MAX_WORKERS) {
+          max_workers = MAX_WORKERS;
+        }
+        speedup(&gme, depth, max_workers);
+        continue;
+      }
+
+      if (strcmp(tok[0], "savehash") == 0 || strcmp(tok[0], "loadhash") == 0) {
+        if (token_count < 2) {
+          fprintf(OUT, "info string usage: %s <file>\n", tok[0]);
+          continue;
+        }
+        if (strcmp(tok[0], "savehash") == 0) {
+          if (tt_save_hashtable(tok[1], zob_id())) {
+            fprintf(OUT, "info string Hash table saved to %s\n", tok[1]);
+          } else {
+            fprintf(OUT, "info string Could not save hash table to %s\n", tok[1]);
+          }
         } else {
-          //          use_precomp = inc > 1750; // inc value when running blitz mode is 500 and inc value when running regular mode is 2000. We want regular mode to use precomputation values
-          goal = tme * 0.02;   // use about 1/50 of main time
-          goal += inc * 0.80;  // use most of increment
-          // sanity check,  make sure that we don't run ourselves too low
-          if (goal*10 > tme) goal = tme / 10.0;
-          UciBeginSearch(&gme[ix], INF_DEPTH, goal);
+          if (tt_load_hashtable(tok[1], zob_id())) {
+            fprintf(OUT, "info string Hash table of %d MB loaded from %s\n",
+                    HASH, tok[1]);
+          } else {
+            fprintf(OUT, "info string Could not load hash table from %s\n", tok[1]);
+          }
+        }
+        continue;
+      }
+
+      if (strcmp(tok[0], "hashbench") == 0) {
+        int sizes[MAX_CHARS_IN_TOKEN];
+        int num_sizes = 0;
+        for (int i = 1; i < token_count && num_sizes < MAX_CHARS_IN_TOKEN; i++) {
+          int size = strtol(tok[i], (char **)NULL, 10);
+          if (size >= 1 && size <= MAX_HASH) {
+            sizes[num_sizes++] = size;
+          }
+        }
+        if (num_sizes == 0) {
+          sizes[num_sizes++] = HASH;
+        }
+        hash_benchmark(sizes, num_sizes);
+        continue;
+      }
+
+      if (strcmp(tok[0], "ttstress") == 0) {
+        int num_workers = 8;
+        int millions = 10;
+        if (token_count >= 2) {
+          num_workers = strtol(tok[1], (char **)NULL, 10);
+        }
+        if (token_count >= 3) {
+          millions = strtol(tok[2], (char **)NULL, 10);
+        }
+        if (num_workers < 1) {
+          num_workers = 1;
+        }
+        if (num_workers > MAX_WORKERS) {
+          num_workers = MAX_WORKERS;
+        }
+        if (millions < 1) {
+          millions = 1;
         }
+        tt_stress(num_workers, (uint64_t) millions * 1000000);
         continue;
       }
 
       if (strcmp(tok[0], "perft") == 0) {  // Test move generator
-        // Correct output to depth 4
-        // perft  1 62
-        // perft  2 3844
-        // perft  3 243058
-        // perft  4 15366794
+        // Correct output to depth 4 from the starting position
+        // (the same for the mailbox and the BITBOARD=1 builds)
+        // perft  1 70
+        // perft  2 4900
+        // perft  3 343987
+        // perft  4 24140334
 
         int depth = 4;
         if (token_count >= 2) {  // Takes a depth argument to test deeper
           depth = strtol(tok[1], (char **)NULL, 10);
         }
-        do_perft(gme, depth, 0);
+        ix = 0;
+        do_perft(&gme, depth, 0);
         continue;
       }
 
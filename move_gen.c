@@ -10,15 +10,17 @@
 #include <inttypes.h>
 
 #include "./tbassert.h"
+#include "./eval.h"
 #include "./fen.h"
 #include "./search.h"
+#include "./tt.h"
 #include "./util.h"
 //#include "./precomp_tables.h"
 
 #define MAX(x, y)  ((x) > (y) ? (x) : (y))
 #define MIN(x, y)  ((x) < (y) ? (x) : (y))
 
-int8_t USE_KO;  // Respect the Ko rule
+int USE_KO;  // Respect the Ko rule
 
 static char *color_strs[2] = {"White", "Black"};
 
@@ -104,7 +106,7 @@ inline uint64_t compute_zob_key(position_t *p) {
   for (fil_t f = 0; f < BOARD_WIDTH; f++) {
     for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
       square_t sq = square_of(f, r);
-      key ^= zob[sq][p->board[sq]];
+      key ^= zob[sq][piece_at(p, sq)];
     }
   }
   if (color_to_move_of(p) == BLACK)
@@ -122,6 +124,58 @@ void init_zob() {
   zob_color = myrand();
 }
 
+bitboard_t square_bb_table[ARR_SIZE];
+uint8_t    bb_index_table[ARR_SIZE];
+square_t   bb_square_table[BB_SQUARES];
+bitboard_t neighbor_bb_table[BB_SQUARES];
+bitboard_t ray_bb_table[BB_SQUARES][NUM_ORI];
+
+void init_bitboards() {
+  for (int sq = 0; sq < ARR_SIZE; sq++) {
+    square_bb_table[sq] = 0;
+    bb_index_table[sq] = 0;
+  }
+  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+      const square_t sq = square_of(f, r);
+      const int i = BOARD_WIDTH * f + r;
+      square_bb_table[sq] = (bitboard_t) 1 << i;
+      bb_index_table[sq] = i;
+      bb_square_table[i] = sq;
+    }
+  }
+  // Neighbors and rays are built by stepping on the 16x16 array, which
+  // already has a border of off-board squares on every side.
+  for (int i = 0; i < BB_SQUARES; i++) {
+    const square_t sq = bb_square_table[i];
+    neighbor_bb_table[i] = 0;
+    for (int d = 0; d < 8; d++) {
+      neighbor_bb_table[i] |= square_bb_table[sq + dir_of(d)];
+    }
+    for (int o = 0; o < NUM_ORI; o++) {
+      ray_bb_table[i][o] = 0;
+      for (square_t s = sq + beam_of(o); square_bb_table[s]; s += beam_of(o)) {
+        ray_bb_table[i][o] |= square_bb_table[s];
+      }
+    }
+  }
+}
+
+// Empties every square of the board.  In the mailbox representation the
+// squares outside the 10x10 area are marked INVALID; callers then fill in
+// the playable squares.
+void clear_board(position_t *p) {
+#if BITBOARD
+  p->color_bb[WHITE] = p->color_bb[BLACK] = 0;
+  p->pawn_bb = p->king_bb = 0;
+  p->ori_bb[0] = p->ori_bb[1] = 0;
+#else
+  for (int i = 0; i < ARR_SIZE; ++i) {
+    p->board[i] = INVALID << PTYPE_SHIFT;
+  }
+#endif
+}
+
 // For no square, use 0, which is guaranteed to be off board
 square_t square_of(fil_t f, rnk_t r) {
   square_t s = ARR_WIDTH * (FIL_ORIGIN + f) + RNK_ORIGIN + r;
@@ -144,31 +198,6 @@ rnk_t rnk_of(square_t sq) {
   return r;
 }
 
-/*
-// For no square, use 0, which is guaranteed to be off board
-inline square_t square_of(const fil_t f, const rnk_t r) {
-//  square_t s = ARR_WIDTH * (FIL_ORIGIN + f) + RNK_ORIGIN + r;
-  square_t s = (square_t)square_of_table[f+3][r+3]; // the fil and rnk range from [-3,10] and [-3, 13] respectively so the +3 accounts for this
-  DEBUG_LOG(1, "Square of (file %d, rank %d) is %d\n", f, r, s);
-  tbassert((s >= 0) && (s < ARR_SIZE), "s: %d\n", s);
-  return s;
-}
-
-// Finds file of square
-inline fil_t fil_of(const square_t sq) {
-//  fil_t f = ((sq >> FIL_SHIFT) & FIL_MASK) - FIL_ORIGIN;
-  fil_t f = (fil_t)(fil_of_table[sq]);
-  DEBUG_LOG(1, "File of square %d is %d\n", sq, f);
-  return f;
-}
-// Finds rank of square
-inline rnk_t rnk_of(const square_t sq) {
-//  rnk_t r = ((sq >> RNK_SHIFT) & RNK_MASK) - RNK_ORIGIN;
-  rnk_t r = (fil_t)rnk_of_table[sq];
-  DEBUG_LOG(1, "Rank of square %d is %d\n", sq, r);
-  return r;
-}
-*/
 
 // converts a square to string notation, returns number of characters printed
 inline int square_to_str(const square_t sq, char *buf, const size_t bufsize) {
@@ -275,26 +304,15 @@ void move_to_str(const move_t mv, char *buf, const size_t bufsize) {
   }
 }
 
+#if !BITBOARD
+
 // Generate all moves from position p.  Returns number of moves.
 // strict currently ignored
 int old_generate_all(position_t *p, sortable_move_t *sortable_move_list,
                  bool strict) {
   color_t color_to_move = color_to_move_of(p);
-  // Make sure that the enemy_laser map is marked
-  char laser_map[ARR_SIZE];
-
-  for (int i = 0; i < ARR_SIZE; ++i) {
-    laser_map[i] = 4;   // Invalid square
-  }
-
-  for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
-    for (rnk_t r = 0; r < BOARD_WIDTH; ++r) {
-      laser_map[square_of(f, r)] = 0;
-    }
-  }
-
-  // 1 = path of laser with no moves
-  mark_laser_path(p, laser_map, opp_color(color_to_move), 1);
+  // Pawns on the enemy laser path are pinned down
+  const bitboard_t pinned = p->laser_bb[opp_color(color_to_move)];
 
   int move_count = 0;
 
@@ -310,7 +328,7 @@ int old_generate_all(position_t *p, sortable_move_t *sortable_move_list,
         case EMPTY:
           break;
         case PAWN:
-          if (laser_map[sq] == 1) continue;  // Piece is pinned down by laser.
+          if (pinned & square_bb(sq)) continue;  // Piece is pinned down by laser.
         case KING:  
           if (color != color_to_move) {  // Wrong color
             break;
@@ -373,31 +391,78 @@ int old_generate_all(position_t *p, sortable_move_t *sortable_move_list,
   return move_count;
 }
 
+#endif  // !BITBOARD
+
+#if BITBOARD
+
+// Generate all moves from position p.  Returns number of moves.
+// strict currently ignored
+// li is the laser info of p, or NULL
+//
+// Same move order as the mailbox version for any single piece: destinations
+// by increasing bit index are destinations by increasing dir_of().
 int generate_all(position_t *p, sortable_move_t *sortable_move_list,
-                 bool strict) {
-  color_t color_to_move = color_to_move_of(p);
-  // Make sure that the enemy_laser map is marked
-  char laser_map[ARR_SIZE];
+                 bool strict, const laser_info_t *li) {
+  const color_t color_to_move = color_to_move_of(p);
+  const bitboard_t own = p->color_bb[color_to_move];
+  const bitboard_t occupied = p->color_bb[WHITE] | p->color_bb[BLACK];
 
-  for (int i = 0; i < ARR_SIZE; ++i) {
-    laser_map[i] = 4;   // Invalid square
-  }
+  // Pawns on the enemy laser path are pinned down
+  const bitboard_t pinned = li ? li->pinned[color_to_move]
+      : p->laser_bb[opp_color(color_to_move)];
 
-  for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
-    for (rnk_t r = 0; r < BOARD_WIDTH; ++r) {
-      laser_map[square_of(f, r)] = 0;
+  int move_count = 0;
+  for (bitboard_t pawns = own & p->pawn_bb & ~pinned; pawns; pawns &= pawns - 1) {
+    const int i = bb_lsb(pawns);
+    const square_t sq = bb_square_of(i);
+
+    // Pawns may move to empty squares or stomp enemy pawns
+    for (bitboard_t dests = neighbor_bb_table[i] & ~(own | p->king_bb);
+         dests; dests &= dests - 1) {
+      tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+      sortable_move_list[move_count++] =
+          move_of(PAWN, (rot_t) 0, sq, bb_square_of(bb_lsb(dests)));
+    }
+
+    // rotations - three directions possible
+    for (int rot = 1; rot < 4; ++rot) {
+      tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+      sortable_move_list[move_count++] = move_of(PAWN, (rot_t) rot, sq, sq);
     }
   }
 
-  // 1 = path of laser with no moves
-  mark_laser_path(p, laser_map, opp_color(color_to_move), 1);
+  const square_t king_sq = p->kloc[color_to_move];
+  for (bitboard_t dests = neighbor_bb_table[bb_index_of(king_sq)] & ~occupied;
+       dests; dests &= dests - 1) {
+    tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+    sortable_move_list[move_count++] =
+        move_of(KING, (rot_t) 0, king_sq, bb_square_of(bb_lsb(dests)));
+  }
+  for (int rot = 1; rot < 4; ++rot) {
+    tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+    sortable_move_list[move_count++] = move_of(KING, (rot_t) rot, king_sq, king_sq);
+  }
+  tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+  sortable_move_list[move_count++] = move_of(KING, (rot_t) 0, king_sq, king_sq);
+
+  return move_count;
+}
+
+#else
+
+int generate_all(position_t *p, sortable_move_t *sortable_move_list,
+                 bool strict, const laser_info_t *li) {
+  color_t color_to_move = color_to_move_of(p);
+  // Pawns on the enemy laser path are pinned down
+  const bitboard_t pinned = li ? li->pinned[color_to_move]
+      : p->laser_bb[opp_color(color_to_move)];
 
   int move_count = 0;
   for(int i = 0; i < NUMBER_PAWNS; i++) {
     square_t sq = p->plocs[color_to_move][i];
     if(sq == 0) continue;
     color_t color = color_to_move;
-    if (laser_map[sq] == 1) continue;
+    if (pinned & square_bb(sq)) continue;
     for (int d = 0; d < 8; d++) {
             int dest = sq + dir_of(d);
             // Skip moves into invalid squares, squares occupied by
@@ -459,7 +524,197 @@ int generate_all(position_t *p, sortable_move_t *sortable_move_list,
   return move_count;
 }
 
-square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
+#endif  // BITBOARD
+
+// -----------------------------------------------------------------------------
+// generate_noisy
+//
+// Generates the moves that may remove a piece, for quiescence search.  A move
+// captures by stomping an enemy pawn or through the laser fired after it.  If
+// that laser already stops on a piece (laser_end), almost any move zaps it and
+// all moves are generated.  Otherwise it leaves the board, and only a move
+// that puts a piece on its path or moves or turns a piece on it can change
+// that: moves of the king, every move of a pawn on the path, and pawn moves
+// onto the path.  The null move never captures here.
+//
+// The result is a superset of the capturing moves, in generate_all order; the
+// search still checks the victims after making each move.  li is the laser
+// info of p and may not be NULL.
+// -----------------------------------------------------------------------------
+
+#if BITBOARD
+
+int generate_noisy(position_t *p, sortable_move_t *sortable_move_list,
+                   const laser_info_t *li) {
+  const color_t color_to_move = color_to_move_of(p);
+  if (p->laser_end[color_to_move] != 0) {
+    return generate_all(p, sortable_move_list, false, li);
+  }
+
+  const bitboard_t path = li->path[color_to_move];
+  const bitboard_t own = p->color_bb[color_to_move];
+  const bitboard_t enemy_pawns = p->color_bb[opp_color(color_to_move)] & p->pawn_bb;
+  const bitboard_t occupied = p->color_bb[WHITE] | p->color_bb[BLACK];
+  const bitboard_t pinned = li->pinned[color_to_move];
+
+  int move_count = 0;
+  for (bitboard_t pawns = own & p->pawn_bb & ~pinned; pawns; pawns &= pawns - 1) {
+    const int i = bb_lsb(pawns);
+    const square_t sq = bb_square_of(i);
+    const bool on_path = (path >> i) & 1;
+
+    bitboard_t dests = neighbor_bb_table[i] & ~(own | p->king_bb);
+    if (!on_path) {
+      dests &= path | enemy_pawns;
+    }
+    for (; dests; dests &= dests - 1) {
+      tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+      sortable_move_list[move_count++] =
+          move_of(PAWN, (rot_t) 0, sq, bb_square_of(bb_lsb(dests)));
+    }
+
+    if (on_path) {
+      for (int rot = 1; rot < 4; ++rot) {
+        tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+        sortable_move_list[move_count++] = move_of(PAWN, (rot_t) rot, sq, sq);
+      }
+    }
+  }
+
+  const square_t king_sq = p->kloc[color_to_move];
+  for (bitboard_t dests = neighbor_bb_table[bb_index_of(king_sq)] & ~occupied;
+       dests; dests &= dests - 1) {
+    tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+    sortable_move_list[move_count++] =
+        move_of(KING, (rot_t) 0, king_sq, bb_square_of(bb_lsb(dests)));
+  }
+  for (int rot = 1; rot < 4; ++rot) {
+    tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+    sortable_move_list[move_count++] = move_of(KING, (rot_t) rot, king_sq, king_sq);
+  }
+
+  return move_count;
+}
+
+#else
+
+int generate_noisy(position_t *p, sortable_move_t *sortable_move_list,
+                   const laser_info_t *li) {
+  const color_t color_to_move = color_to_move_of(p);
+  if (p->laser_end[color_to_move] != 0) {
+    return generate_all(p, sortable_move_list, false, li);
+  }
+
+  const bitboard_t path = li->path[color_to_move];
+  const bitboard_t pinned = li->pinned[color_to_move];
+
+  int move_count = 0;
+  for (int i = 0; i < NUMBER_PAWNS; i++) {
+    const square_t sq = p->plocs[color_to_move][i];
+    if (sq == 0 || (pinned & square_bb(sq))) continue;
+    const bool on_path = (path & square_bb(sq)) != 0;
+
+    for (int d = 0; d < 8; d++) {
+      const square_t dest = sq + dir_of(d);
+      const ptype_t typ = ptype_of(p->board[dest]);
+      if (typ == INVALID ||
+          typ == KING ||
+          (typ == PAWN && color_to_move == color_of(p->board[dest]))) {
+        continue;    // illegal square
+      }
+      if (!on_path && typ != PAWN && !(path & square_bb(dest))) {
+        continue;    // neither a stomp nor in the way of the laser
+      }
+      tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+      sortable_move_list[move_count++] = move_of(PAWN, (rot_t) 0, sq, dest);
+    }
+
+    if (on_path) {
+      for (int rot = 1; rot < 4; ++rot) {
+        tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+        sortable_move_list[move_count++] = move_of(PAWN, (rot_t) rot, sq, sq);
+      }
+    }
+  }
+
+  const square_t king_sq = p->kloc[color_to_move];
+  for (int d = 0; d < 8; d++) {
+    const square_t dest = king_sq + dir_of(d);
+    if (ptype_of(p->board[dest]) != EMPTY) {
+      continue;    // illegal square
+    }
+    tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+    sortable_move_list[move_count++] = move_of(KING, (rot_t) 0, king_sq, dest);
+  }
+  for (int rot = 1; rot < 4; ++rot) {
+    tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+    sortable_move_list[move_count++] = move_of(KING, (rot_t) rot, king_sq, king_sq);
+  }
+
+  return move_count;
+}
+
+#endif  // BITBOARD
+
+// Returns true if generate_all(p) would generate mv.  Lets the search try a
+// move from the transposition table or the killer table before generating
+// anything.
+bool is_pseudo_legal(position_t *p, const move_t mv) {
+  const color_t color_to_move = color_to_move_of(p);
+  const ptype_t typ = ptype_mv_of(mv);
+  const square_t from_sq = from_square(mv);
+  const square_t to_sq = to_square(mv);
+  const piece_t x = piece_at(p, from_sq);
+
+  if ((typ != PAWN && typ != KING) ||
+      ptype_of(x) != typ || color_of(x) != color_to_move) {
+    return false;
+  }
+  if (typ == PAWN &&  // Pawns on the enemy laser path are pinned down
+      (p->laser_bb[opp_color(color_to_move)] & square_bb(from_sq))) {
+    return false;
+  }
+  if (to_sq == from_sq) {  // rotation, or the null move of a king
+    return rot_of(mv) != NONE || typ == KING;
+  }
+  if (rot_of(mv) != NONE ||
+      !(neighbor_bb_table[bb_index_of(from_sq)] & square_bb(to_sq))) {
+    return false;
+  }
+
+  const piece_t y = piece_at(p, to_sq);
+  if (typ == KING) {
+    return ptype_of(y) == EMPTY;
+  }
+  return ptype_of(y) == EMPTY ||
+      (ptype_of(y) == PAWN && color_of(y) != color_to_move);
+}
+
+#if !BITBOARD
+
+// Moves the pawn of color c on from_sq to to_sq in plocs (to_sq 0 removes
+// it), recording the old slot contents in u for undo_move.
+static void move_pawn_slot(position_t *p, undo_t *u, const color_t c,
+                           const square_t from_sq, const square_t to_sq) {
+  for (int i = 0; i < NUMBER_PAWNS; i++) {
+    if (p->plocs[c][i] == from_sq) {
+      tbassert(u->num_pawn_slots < MAX_PAWN_SLOTS_CHANGED,
+               "num_pawn_slots: %d\n", u->num_pawn_slots);
+      u->pawn_slot[u->num_pawn_slots] = c * NUMBER_PAWNS + i;
+      u->pawn_sq[u->num_pawn_slots] = from_sq;
+      u->num_pawn_slots++;
+      p->plocs[c][i] = to_sq;
+      return;
+    }
+  }
+}
+
+#endif
+
+// Moves the piece in place, saving what undo_move needs in u.  Returns the
+// destination of a stomped pawn, or 0 if nothing was stomped.  The laser
+// paths are left for the caller to update.
+square_t low_level_make_move(position_t *p, const move_t mv, undo_t *u) {
   tbassert(mv != 0, "mv was zero.\n");
 
   square_t stomped_dst_sq = 0;
@@ -470,13 +725,13 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
       DEBUG_LOG(1, "low_level_make_move: %s\n", buf);
     });
 
-  tbassert(old->key == compute_zob_key(old),
-           "old->key: %"PRIu64", zob-key: %"PRIu64"\n",
-           old->key, compute_zob_key(old));
+  tbassert(p->key == compute_zob_key(p),
+           "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
+           p->key, compute_zob_key(p));
 
   WHEN_DEBUG_VERBOSE({
       fprintf(stderr, "Before:\n");
-      display(old);
+      display(p);
     });
 
   square_t from_sq = from_square(mv);
@@ -508,22 +763,38 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
       }
     });
 
-  *p = *old; // needs to copy key
-
-  p->history = old;
+  u->history = p->history;
+  u->key = p->key;
+  u->victims = p->victims;
+  u->last_move = p->last_move;
+  u->kloc[WHITE] = p->kloc[WHITE];
+  u->kloc[BLACK] = p->kloc[BLACK];
+  u->zapped_sq = 0;
+  u->laser_bb[WHITE] = p->laser_bb[WHITE];
+  u->laser_bb[BLACK] = p->laser_bb[BLACK];
+  u->laser_end[WHITE] = p->laser_end[WHITE];
+  u->laser_end[BLACK] = p->laser_end[BLACK];
+  u->ev = p->ev;
+#if !BITBOARD
+  u->num_pawn_slots = 0;
+#endif
+
+  p->history = u;
   p->last_move = mv;
 
   tbassert(from_sq < ARR_SIZE && from_sq > 0, "from_sq: %d\n", from_sq);
-  tbassert(p->board[from_sq] < (1 << PIECE_SIZE) && p->board[from_sq] >= 0,
-           "p->board[from_sq]: %d\n", p->board[from_sq]);
+  tbassert(piece_at(p, from_sq) < (1 << PIECE_SIZE),
+           "piece_at(p, from_sq): %d\n", piece_at(p, from_sq));
   tbassert(to_sq < ARR_SIZE && to_sq > 0, "to_sq: %d\n", to_sq);
-  tbassert(p->board[to_sq] < (1 << PIECE_SIZE) && p->board[to_sq] >= 0,
-           "p->board[to_sq]: %d\n", p->board[to_sq]);
+  tbassert(piece_at(p, to_sq) < (1 << PIECE_SIZE),
+           "piece_at(p, to_sq): %d\n", piece_at(p, to_sq));
 
   p->key ^= zob_color;   // swap color to move
 
-  piece_t from_piece = p->board[from_sq];
-  const piece_t to_piece = p->board[to_sq];
+  piece_t from_piece = piece_at(p, from_sq);
+  const piece_t to_piece = piece_at(p, to_sq);
+  u->from_piece = from_piece;
+  u->to_piece = to_piece;
 
   // Pieces block each other, unless a pawn is stomping an enemy pawn
   tbassert(EMPTY == ptype_of(to_piece) ||
@@ -550,8 +821,8 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
     p->key ^= zob[from_sq][from_piece];  // remove from_piece from from_sq
     p->key ^= zob[to_sq][to_piece];  // remove to_piece from to_sq
 
-    p->board[to_sq] = from_piece;  // swap from_piece and to_piece on board
-    p->board[from_sq] = to_piece;
+    set_piece(p, to_sq, from_piece);  // swap from_piece and to_piece on board
+    set_piece(p, from_sq, to_piece);
 
     p->key ^= zob[to_sq][from_piece];  // place from_piece in to_sq
     p->key ^= zob[from_sq][to_piece];  // place to_piece in from_sq
@@ -563,27 +834,35 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
     if (ptype_of(to_piece) == KING) {
       p->kloc[color_of(to_piece)] = from_sq;
     }
+#if !BITBOARD
     // Update pawn locations if necessary
     if (ptype_of(from_piece) == PAWN) {
-      for(int i = 0; i < NUMBER_PAWNS; i++) {
-        if(p->plocs[color_of(from_piece)][i] == from_sq) {
-          p->plocs[color_of(from_piece)][i] = to_sq;
-        }
-      }
+      move_pawn_slot(p, u, color_of(from_piece), from_sq, to_sq);
     }
     if (ptype_of(to_piece) == PAWN) {
-      for(int i = 0; i < NUMBER_PAWNS; i++) {
-        if(p->plocs[color_of(to_piece)][i] == to_sq) {
-          p->plocs[color_of(to_piece)][i] = from_sq;
-        }
-      }
+      move_pawn_slot(p, u, color_of(to_piece), to_sq, from_sq);
+    }
+#endif
+
+    // Update the running evaluation sums
+    if (ptype_of(from_piece) == PAWN) {
+      update_eval_pawn_moved(p, color_of(from_piece), from_sq, to_sq);
+    }
+    if (ptype_of(to_piece) == PAWN) {
+      update_eval_pawn_moved(p, color_of(to_piece), to_sq, from_sq);
+    }
+    if (ptype_of(from_piece) == KING) {
+      p->ev.kings_stale = true;
     }
   } else {  // rotation
     // remove from_piece from from_sq in hash
     p->key ^= zob[from_sq][from_piece];
     set_ori(&from_piece, rot + ori_of(from_piece));  // rotate from_piece
-    p->board[from_sq] = from_piece;  // place rotated piece on board
+    set_piece(p, from_sq, from_piece);  // place rotated piece on board
     p->key ^= zob[from_sq][from_piece];              // ... and in hash
+    if (ptype_of(from_piece) == KING) {
+      p->ev.kings_stale = true;
+    }
   }
 
   // Increment ply
@@ -602,16 +881,85 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
 }
 
 
-// returns square of piece to be removed from board or 0
-square_t fire(position_t *p) {
-  const color_t fake_color_to_move = (color_to_move_of(p) == WHITE) ? BLACK : WHITE;
-  square_t sq = p->kloc[fake_color_to_move];
-  int8_t bdir = ori_of(p->board[sq]);
+// Removes the piece on sq from the board, the hash key and the pawn
+// locations.  Returns the piece that was removed.
+static piece_t remove_piece(position_t *p, const square_t sq, undo_t *u) {
+  const piece_t x = piece_at(p, sq);
+  p->key ^= zob[sq][x];   // remove from board
+  set_piece(p, sq, EMPTY);
+  p->key ^= zob[sq][EMPTY];
+#if !BITBOARD
+  if (ptype_of(x) == PAWN) {
+    move_pawn_slot(p, u, color_of(x), sq, 0);
+  }
+#endif
+  if (ptype_of(x) == PAWN) {
+    update_eval_pawn_removed(p, color_of(x), sq);
+  }
+  return x;
+}
 
-  tbassert(ptype_of(p->board[ p->kloc[fake_color_to_move] ]) == KING,
-           "ptype_of(p->board[ p->kloc[fake_color_to_move] ]): %d\n",
-           ptype_of(p->board[ p->kloc[fake_color_to_move] ]));
-  
+// -----------------------------------------------------------------------------
+// Laser paths
+//
+// Each position caches the path of both lasers: laser_bb[c] has every square
+// the laser of king c passes through, from the king itself up to and
+// including the square it stops on, and laser_end[c] is the square it stops
+// on (a king, or a pawn hit in the back), or 0 if it leaves the board.  A
+// path only changes when a piece appears on, leaves or turns on one of its
+// squares, so do_move retraces a laser only when the move touches its path.
+// -----------------------------------------------------------------------------
+
+#if BITBOARD
+
+// Traces the laser of king c into p->laser_bb[c] and p->laser_end[c].
+void trace_laser(position_t *p, const color_t c) {
+  const bitboard_t occupied = p->color_bb[WHITE] | p->color_bb[BLACK];
+  int i = bb_index_of(p->kloc[c]);
+  bitboard_t path = (bitboard_t) 1 << i;
+
+  p->laser_end[c] = 0;
+  if (!(p->king_bb & p->color_bb[c] & path)) {  // the king was zapped
+    p->laser_bb[c] = 0;
+    return;
+  }
+
+  int8_t bdir = bb_ori_at(p, i);
+  while (true) {
+    const bitboard_t ray = ray_bb_table[i][bdir];
+    const bitboard_t hits = ray & occupied;
+    if (!hits) {  // Ran off edge of board
+      p->laser_bb[c] = path | ray;
+      return;
+    }
+    i = bb_first_hit(hits, bdir);
+    path |= ray & ~ray_bb_table[i][bdir];  // up to and including the hit
+    if (p->king_bb & ((bitboard_t) 1 << i)) {
+      break;
+    }
+    bdir = reflect_of(bdir, bb_ori_at(p, i));
+    if (bdir < 0) {  // Hit back of Pawn
+      break;
+    }
+  }
+  p->laser_bb[c] = path;
+  p->laser_end[c] = bb_square_of(i);
+}
+
+#else
+
+// Traces the laser of king c into p->laser_bb[c] and p->laser_end[c].
+void trace_laser(position_t *p, const color_t c) {
+  square_t sq = p->kloc[c];
+  bitboard_t path = square_bb(sq);
+
+  p->laser_end[c] = 0;
+  if (ptype_of(p->board[sq]) != KING || color_of(p->board[sq]) != c) {
+    p->laser_bb[c] = 0;  // the king was zapped
+    return;
+  }
+
+  int8_t bdir = ori_of(p->board[sq]);
   int8_t beam = beam_of(bdir);
   while (true) {
     sq += beam;
@@ -619,20 +967,25 @@ square_t fire(position_t *p) {
 
     switch (ptype_of(p->board[sq])) {
       case EMPTY:  // empty square
+        path |= square_bb(sq);
         break;
       case PAWN:  // Pawn
+        path |= square_bb(sq);
         bdir = reflect_of(bdir, ori_of(p->board[sq]));
         if (bdir < 0) {  // Hit back of Pawn
-          return sq;
+          p->laser_bb[c] = path;
+          p->laser_end[c] = sq;
+          return;
         }
         beam = beam_of(bdir);
         break;
       case KING:  // King
-        return sq;  // sorry, game over my friend!
-        break;
+        p->laser_bb[c] = path | square_bb(sq);
+        p->laser_end[c] = sq;  // sorry, game over my friend!
+        return;
       case INVALID:  // Ran off edge of board
-        return 0;
-        break;
+        p->laser_bb[c] = path;
+        return;
       default:  // Shouldna happen, man!
         tbassert(false, "Like porkchops and whipped cream.\n");
         break;
@@ -640,15 +993,40 @@ square_t fire(position_t *p) {
   }
 }
 
+#endif  // BITBOARD
+
+void init_laser_paths(position_t *p) {
+  trace_laser(p, WHITE);
+  trace_laser(p, BLACK);
+}
+
+// Retraces the lasers whose path runs through one of the touched squares.
+static void update_laser_paths(position_t *p, const bitboard_t touched) {
+  if (p->laser_bb[WHITE] & touched) {
+    trace_laser(p, WHITE);
+  }
+  if (p->laser_bb[BLACK] & touched) {
+    trace_laser(p, BLACK);
+  }
+}
+
+// returns square of piece to be removed from board or 0
+square_t fire(position_t *p) {
+  const color_t fake_color_to_move = (color_to_move_of(p) == WHITE) ? BLACK : WHITE;
+  return p->laser_end[fake_color_to_move];
+}
+
 
-// return victim pieces or KO
-victims_t make_move(position_t *old, position_t *p, const move_t mv) {
+// Makes mv in place and returns the victim pieces, or KO.  The move is made
+// even when KO is returned; every do_move must be paired with an undo_move
+// using the same u.
+victims_t do_move(position_t *p, const move_t mv, undo_t *u) {
   tbassert(mv != 0, "mv was zero.\n");
 
   WHEN_DEBUG_VERBOSE(char buf[MAX_CHARS_IN_MOVE]);
 
   // move phase 1 - moving a piece, which may result in a stomp
-  const square_t stomped_sq = low_level_make_move(old, p, mv);
+  const square_t stomped_sq = low_level_make_move(p, mv, u);
 
   WHEN_DEBUG_VERBOSE({
       if (stomped_sq != 0) {
@@ -662,17 +1040,7 @@ victims_t make_move(position_t *old, position_t *p, const move_t mv) {
     // Don't check for Ko yet.
 
   } else {  // we definitely stomped something
-    p->victims.stomped = p->board[stomped_sq];
-
-    const color_t stomped_color = color_of(p->board[stomped_sq]);
-    p->key ^= zob[stomped_sq][p->victims.stomped];   // remove from board
-    p->board[stomped_sq] = 0;
-    for(int i = 0; i < NUMBER_PAWNS; i++) {
-      if(p->plocs[stomped_color][i] == stomped_sq) {
-        p->plocs[stomped_color][i] = 0;
-      }
-    }
-    p->key ^= zob[stomped_sq][p->board[stomped_sq]];
+    p->victims.stomped = remove_piece(p, stomped_sq, u);
 
     tbassert(p->key == compute_zob_key(p),
              "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
@@ -684,6 +1052,14 @@ victims_t make_move(position_t *old, position_t *p, const move_t mv) {
       });
   }
 
+  // Unless the laser hits something, this is the key of the new position.
+  // Its transposition table set is fetched while the laser is traced.
+  tt_prefetch(p->key);
+
+  // The stomp, if any, happened on from_sq, so these two squares cover
+  // every change to the board so far.
+  update_laser_paths(p, square_bb(from_square(mv)) | square_bb(to_square(mv)));
+
   // move phase 2 - shooting the laser
   const square_t victim_sq = fire(p);
 
@@ -698,22 +1074,14 @@ victims_t make_move(position_t *old, position_t *p, const move_t mv) {
     p->victims.zapped = 0;
     if (USE_KO &&  // Ko rule
         zero_victims(p->victims) &&
-        (p->key == (old->key ^ zob_color))) {
-//    if (zero_victims(p->victims) &&
-//        (p->key == (old->key ^ zob_color))) {
+        (p->key == (u->key ^ zob_color))) {
       return KO();
     }
   } else {  // we definitely hit something with laser
-    color_t zapped_color = color_of(p->board[victim_sq]);
-    p->victims.zapped = p->board[victim_sq];
-    p->key ^= zob[victim_sq][p->victims.zapped];   // remove from board
-    p->board[victim_sq] = 0;
-    p->key ^= zob[victim_sq][0];
-    for(int i = 0; i < NUMBER_PAWNS; i++) {
-      if(p->plocs[zapped_color][i] == victim_sq) { 
-        p->plocs[zapped_color][i] = 0;
-      }
-    }
+    p->victims.zapped = remove_piece(p, victim_sq, u);
+    u->zapped_sq = victim_sq;
+    tt_prefetch(p->key);
+    update_laser_paths(p, square_bb(victim_sq));
     tbassert(p->key == compute_zob_key(p),
              "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
              p->key, compute_zob_key(p));
@@ -727,11 +1095,48 @@ victims_t make_move(position_t *old, position_t *p, const move_t mv) {
   return p->victims;
 }
 
+// Takes back the move do_move made with undo record u.
+void undo_move(position_t *p, const undo_t *u) {
+  const square_t from_sq = from_square(p->last_move);
+  const square_t to_sq = to_square(p->last_move);
+
+  // Put the zapped piece back first: it may be the piece that just moved,
+  // and the from and to squares are overwritten with their old contents
+  // below anyway.  A stomped pawn comes back as to_piece.
+  if (u->zapped_sq != 0) {
+    set_piece(p, u->zapped_sq, p->victims.zapped);
+  }
+  set_piece(p, to_sq, u->to_piece);
+  set_piece(p, from_sq, u->from_piece);
+
+#if !BITBOARD
+  for (int k = u->num_pawn_slots - 1; k >= 0; k--) {
+    (&p->plocs[0][0])[u->pawn_slot[k]] = u->pawn_sq[k];
+  }
+#endif
+
+  p->kloc[WHITE] = u->kloc[WHITE];
+  p->kloc[BLACK] = u->kloc[BLACK];
+  p->laser_bb[WHITE] = u->laser_bb[WHITE];
+  p->laser_bb[BLACK] = u->laser_bb[BLACK];
+  p->laser_end[WHITE] = u->laser_end[WHITE];
+  p->laser_end[BLACK] = u->laser_end[BLACK];
+  p->ev = u->ev;
+  p->key = u->key;
+  p->history = u->history;
+  p->victims = u->victims;
+  p->last_move = u->last_move;
+  p->ply--;
+
+  tbassert(p->key == compute_zob_key(p),
+           "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
+           p->key, compute_zob_key(p));
+}
+
 // helper function for do_perft
 // ply starting with 0
 static uint64_t perft_search(position_t *p, const int depth, const int ply) {
   uint64_t node_count = 0;
-  position_t np;
   sortable_move_t lst[MAX_NUM_MOVES];
   int i;
 
@@ -739,7 +1144,7 @@ static uint64_t perft_search(position_t *p, const int depth, const int ply) {
     return 1;
   }
 
-  const int num_moves = generate_all(p, lst, true);
+  const int num_moves = generate_all(p, lst, true, NULL);
 
   if (depth == 1) {
     return num_moves;
@@ -747,37 +1152,18 @@ static uint64_t perft_search(position_t *p, const int depth, const int ply) {
 
   for (i = 0; i < num_moves; i++) {
     move_t mv = get_move(lst[i]);
+    undo_t undo;
 
-    const square_t stomped_sq = low_level_make_move(p, &np, mv);  // make the move baby!
-
-    if (stomped_sq != 0) {
-      tbassert(ptype_of(np.board[stomped_sq]) == PAWN,
-               "ptype_of(np.board[stomped_sq]): %d\n",
-               ptype_of(np.board[stomped_sq]));
+    // perft counts everything generate_all produces, so Ko positions are
+    // expanded like any other.
+    const victims_t victims = do_move(p, mv, &undo);  // make the move baby!
 
-      np.victims.stomped = np.board[stomped_sq];
-      np.key ^= zob[stomped_sq][np.victims.stomped];   // remove from board
-      np.board[stomped_sq] = 0;
-      np.key ^= zob[stomped_sq][0];
+    if (!is_KO(victims) && ptype_of(victims.zapped) == KING) {
+      node_count++;  // do not expand further: hit a King
+    } else {
+      node_count += perft_search(p, depth-1, ply+1);
     }
-
-    square_t victim_sq = fire(&np);  // the guy to disappear
-
-    if (victim_sq != 0) {            // hit a piece
-      const ptype_t typ = ptype_of(np.board[victim_sq]);
-      tbassert((typ != EMPTY) && (typ != INVALID), "typ: %d\n", typ);
-      if (typ == KING) {  // do not expand further: hit a King
-        node_count++;
-        continue;
-      }
-      np.victims.zapped = np.board[victim_sq];
-      np.key ^= zob[victim_sq][np.victims.zapped];   // remove from board
-      np.board[victim_sq] = 0;
-      np.key ^= zob[victim_sq][0];
-    }
-
-    const uint64_t partialcount = perft_search(&np, depth-1, ply+1);
-    node_count += partialcount;
+    undo_move(p, &undo);
   }
 
   return node_count;
@@ -812,31 +1198,32 @@ void display(position_t *p) {
     printf("info Last move: NULL\n");
   }
 
-  for (rnk_t r = BOARD_WIDTH - 1; r >=0 ; --r) {
+  for (int r = BOARD_WIDTH - 1; r >= 0; --r) {
     printf("\ninfo %1d  ", r);
     for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
       square_t sq = square_of(f, r);
+      const piece_t x = piece_at(p, sq);
 
-      tbassert(ptype_of(p->board[sq]) != INVALID,
-               "ptype_of(p->board[sq]): %d\n", ptype_of(p->board[sq]));
+      tbassert(ptype_of(x) != INVALID,
+               "ptype_of(x): %d\n", ptype_of(x));
       /*if (p->blocked[sq]) {
         printf(" xx");
         continue;
       }*/
-      if (ptype_of(p->board[sq]) == EMPTY) {       // empty square
+      if (ptype_of(x) == EMPTY) {       // empty square
         printf(" --");
         continue;
       }
 
-      const int ori = ori_of(p->board[sq]);  // orientation
-      const color_t c = color_of(p->board[sq]);
+      const int ori = ori_of(x);  // orientation
+      const color_t c = color_of(x);
 
-      if (ptype_of(p->board[sq]) == KING) {
+      if (ptype_of(x) == KING) {
         printf(" %2s", king_ori_to_rep[c][ori]);
         continue;
       }
 
-      if (ptype_of(p->board[sq]) == PAWN) {
+      if (ptype_of(x) == PAWN) {
         printf(" %2s", pawn_ori_to_rep[c][ori]);
         continue;
       }
@@ -879,6 +1266,7 @@ inline bool victim_exists(const victims_t victims) {
 }
 
 void assert_pawn_locs(position_t * p) {
+#if !BITBOARD
   /*  for(int c = 0; c < 2; c++) {
     for(int i = 0; i < NUMBER_PAWNS; i++) {
       square_t sq = p->plocs[c][i];
@@ -903,4 +1291,5 @@ void assert_pawn_locs(position_t * p) {
       }
     }
   }
+#endif
 }
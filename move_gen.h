@@ -21,9 +21,6 @@
 
 // board is 8 x 8 or 10 x 10
 #define BOARD_WIDTH 10
-// bonus divisor for pcentral method in eval.c
-#define BONUS_DIVISOR 10 / sqrt(2)
-#define BONUS_MULTIPLIER sqrt(2) / 10
 typedef uint8_t square_t;
 typedef uint8_t rnk_t;
 typedef uint8_t fil_t;
@@ -139,21 +136,211 @@ typedef struct victims_t {
 #define ILLEGAL_STOMPED MAX_UINT8_T
 #define ILLEGAL_ZAPPED MAX_UINT8_T
 
+// -----------------------------------------------------------------------------
+// bitboards
+// -----------------------------------------------------------------------------
+
+// One bit per playable square.  Bit index is BOARD_WIDTH * file + rank, so
+// stepping north/east increases the index and stepping south/west decreases
+// it.  Squares in moves and everywhere else are still 16x16 square_t values;
+// the tables below translate between the two.
+#define BB_SQUARES (BOARD_WIDTH * BOARD_WIDTH)
+
+typedef __uint128_t bitboard_t;
+
+extern bitboard_t square_bb_table[ARR_SIZE];      // 0 for off-board squares
+extern uint8_t    bb_index_table[ARR_SIZE];
+extern square_t   bb_square_table[BB_SQUARES];
+extern bitboard_t neighbor_bb_table[BB_SQUARES];  // the 8 surrounding squares
+extern bitboard_t ray_bb_table[BB_SQUARES][4];    // NN, EE, SS, WW; excl. origin
+
+static inline bitboard_t square_bb(const square_t sq) {
+  return square_bb_table[sq];
+}
+
+static inline int bb_index_of(const square_t sq) {
+  return bb_index_table[sq];
+}
+
+static inline square_t bb_square_of(const int index) {
+  return bb_square_table[index];
+}
+
+// index of the lowest set bit; b must be nonzero
+static inline int bb_lsb(const bitboard_t b) {
+  const uint64_t lo = (uint64_t) b;
+  return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll((uint64_t) (b >> 64));
+}
+
+// index of the highest set bit; b must be nonzero
+static inline int bb_msb(const bitboard_t b) {
+  const uint64_t hi = (uint64_t) (b >> 64);
+  return hi ? 127 - __builtin_clzll(hi) : 63 - __builtin_clzll((uint64_t) b);
+}
+
+static inline int bb_popcount(const bitboard_t b) {
+  return __builtin_popcountll((uint64_t) b) +
+      __builtin_popcountll((uint64_t) (b >> 64));
+}
+
 // -----------------------------------------------------------------------------
 // position
 // -----------------------------------------------------------------------------
 
+// Running sums of the evaluation terms that do not depend on the lasers.
+// eval.c computes them (init_eval_sums) and do_move keeps them up to date,
+// except that a king move only sets kings_stale and eval() catches up.
+typedef struct eval_sums {
+  int32_t      pawns[2];         // MATERIAL and PCENTRAL of each side's pawns
+  int32_t      kings[2];         // KFACE and KAGGRESSIVE of each side's king
+  uint8_t      num_pawns[2];
+  uint8_t      pbetween[2];      // pawns inside the rectangle of the kings
+  bool         kings_stale;      // a king moved: kings and pbetween are out of date
+} eval_sums_t;
+
+// Pawn slots do_move may touch in plocs: the mover, a stomped pawn (moved
+// and then removed) and a zapped pawn.
+#define MAX_PAWN_SLOTS_CHANGED 4
+
+// Everything undo_move() needs to take back a move that do_move() made in
+// place.  The first three fields hold the position as it was before the
+// move, so the chain of undo records through history is also the game
+// history that repetition detection walks.
+typedef struct undo {
+  struct undo  *history;         // history before the move
+  uint64_t     key;              // hash key before the move
+  victims_t    victims;          // victims of the move before this one
+  move_t       last_move;
+  square_t     kloc[2];
+  piece_t      from_piece;       // pieces on the from and to squares
+  piece_t      to_piece;         //   before the move
+  square_t     zapped_sq;        // 0 if the laser did not remove anything
+  square_t     laser_end[2];
+  bitboard_t   laser_bb[2];
+  eval_sums_t  ev;
+#if !BITBOARD
+  int8_t       num_pawn_slots;
+  uint8_t      pawn_slot[MAX_PAWN_SLOTS_CHANGED];  // index into plocs[0]
+  square_t     pawn_sq[MAX_PAWN_SLOTS_CHANGED];    // previous contents
+#endif
+} undo_t;
+
+// Compile with BITBOARD=1 to replace the 16x16 mailbox by occupancy and
+// orientation bitboards.  Everything outside move_gen.c and eval.c should go
+// through piece_at() and set_piece() so that it works with either one.
+#if BITBOARD
+
+typedef struct position {
+  bitboard_t   color_bb[2];      // squares occupied by each color
+  bitboard_t   pawn_bb;          // squares occupied by pawns
+  bitboard_t   king_bb;          // squares occupied by kings
+  bitboard_t   ori_bb[2];        // orientation of each piece, one plane per bit
+  bitboard_t   laser_bb[2];      // laser path of each king, see trace_laser()
+  undo_t       *history;         // history of position
+  uint64_t     key;              // hash key
+  int16_t      ply;              // Even ply are White, odd are Black
+  move_t       last_move;        // move that led to this position
+  victims_t    victims;          // pieces destroyed by shooter or stomper
+  square_t     kloc[2];          // location of kings
+  square_t     laser_end[2];     // square each laser stops on, 0 if none
+  eval_sums_t  ev;               // see eval_sums_t
+} position_t;
+
+#else
+
 typedef struct position {
   piece_t      board[ARR_SIZE];
-  struct position  *history;     // history of position
+  bitboard_t   laser_bb[2];      // laser path of each king, see trace_laser()
+  undo_t       *history;         // history of position
   uint64_t     key;              // hash key
   int16_t      ply;              // Even ply are White, odd are Black
   move_t       last_move;        // move that led to this position
   victims_t    victims;          // pieces destroyed by shooter or stomper
   square_t     kloc[2];          // location of kings
+  square_t     laser_end[2];     // square each laser stops on, 0 if none
+  eval_sums_t  ev;               // see eval_sums_t
   square_t     plocs[2][NUMBER_PAWNS];
 } position_t;
 
+#endif  // BITBOARD
+
+// What the lasers do in a position.  The search computes it once per node
+// (get_laser_info in eval.c) for both move generation and eval.
+typedef struct laser_info {
+  bitboard_t   path[2];          // squares each color's laser crosses
+  bitboard_t   pinned[2];        // each color's pawns on the enemy laser path
+  int8_t       pawnpin[2];       // number of pinned pawns of each color
+  int8_t       mobility[2];      // safe squares around each color's king
+  int8_t       h_attackable[2];  // how close the enemy laser gets to the king
+} laser_info_t;
+
+// piece on square sq, INVALID for squares off the board
+static inline piece_t piece_at(const position_t *p, const square_t sq) {
+#if BITBOARD
+  const bitboard_t b = square_bb(sq);
+  if (!b) {
+    return INVALID << PTYPE_SHIFT;
+  }
+  piece_t x;
+  if (p->pawn_bb & b) {
+    x = PAWN << PTYPE_SHIFT;
+  } else if (p->king_bb & b) {
+    x = KING << PTYPE_SHIFT;
+  } else {
+    return EMPTY;
+  }
+  if (p->color_bb[BLACK] & b) x |= BLACK << COLOR_SHIFT;
+  if (p->ori_bb[0] & b) x |= 1 << ORI_SHIFT;
+  if (p->ori_bb[1] & b) x |= 2 << ORI_SHIFT;
+  return x;
+#else
+  return p->board[sq];
+#endif
+}
+
+#if BITBOARD
+
+// orientation of the piece on bit i
+static inline int8_t bb_ori_at(const position_t *p, const int i) {
+  return ((p->ori_bb[0] >> i) & 1) | (((p->ori_bb[1] >> i) & 1) << 1);
+}
+
+// The first piece a beam meets is the lowest set bit of the ray for beams
+// going north or east, and the highest set bit for beams going south or west.
+static inline int bb_first_hit(const bitboard_t hits, const int bdir) {
+  return (bdir == NN || bdir == EE) ? bb_lsb(hits) : bb_msb(hits);
+}
+
+#endif  // BITBOARD
+
+// place piece x on square sq.  Does not touch the hash key or piece lists.
+static inline void set_piece(position_t *p, const square_t sq, const piece_t x) {
+#if BITBOARD
+  const bitboard_t b = square_bb(sq);
+  const int ori = (x >> ORI_SHIFT) & ORI_MASK;
+  const int typ = (x >> PTYPE_SHIFT) & PTYPE_MASK;
+  p->color_bb[WHITE] &= ~b;
+  p->color_bb[BLACK] &= ~b;
+  p->pawn_bb &= ~b;
+  p->king_bb &= ~b;
+  p->ori_bb[0] &= ~b;
+  p->ori_bb[1] &= ~b;
+  if (typ != PAWN && typ != KING) {
+    return;
+  }
+  p->color_bb[(x >> COLOR_SHIFT) & COLOR_MASK] |= b;
+  if (typ == PAWN) {
+    p->pawn_bb |= b;
+  } else {
+    p->king_bb |= b;
+  }
+  if (ori & 1) p->ori_bb[0] |= b;
+  if (ori & 2) p->ori_bb[1] |= b;
+#else
+  p->board[sq] = x;
+#endif
+}
+
 // -----------------------------------------------------------------------------
 // Function prototypes
 // -----------------------------------------------------------------------------
@@ -168,6 +355,8 @@ void set_ptype(piece_t *x, ptype_t pt);
 int8_t ori_of(piece_t x);
 void set_ori(piece_t *x, int ori);
 void init_zob();
+void init_bitboards();
+void clear_board(position_t *p);
 square_t square_of(fil_t f, rnk_t r);
 fil_t fil_of(square_t sq);
 rnk_t rnk_of(square_t sq);
@@ -182,10 +371,14 @@ rot_t rot_of(move_t mv);
 move_t move_of(ptype_t typ, rot_t rot, square_t from_sq, square_t to_sq);
 void move_to_str(move_t mv, char *buf, size_t bufsize);
 int generate_all(position_t *p, sortable_move_t *sortable_move_list,
-                 bool strict);
+                 bool strict, const laser_info_t *li);
+int generate_noisy(position_t *p, sortable_move_t *sortable_move_list,
+                   const laser_info_t *li);
+bool is_pseudo_legal(position_t *p, move_t mv);
 void do_perft(position_t *gme, int depth, int ply);
-piece_t low_level_make_move(position_t *old, position_t *p, move_t mv);
-victims_t make_move(position_t *old, position_t *p, move_t mv);
+square_t low_level_make_move(position_t *p, move_t mv, undo_t *u);
+victims_t do_move(position_t *p, move_t mv, undo_t *u);
+void undo_move(position_t *p, const undo_t *u);
 void display(position_t *p);
 uint64_t compute_zob_key(position_t *p);
 
@@ -197,7 +390,7 @@ bool is_KO(victims_t victims);
 bool zero_victims(victims_t victims);
 bool victim_exists(victims_t victims);
 
-void mark_laser_path(position_t *p, char *laser_map, color_t c,
-                     char mark_mask);
+void trace_laser(position_t *p, color_t c);
+void init_laser_paths(position_t *p);
 void assert_pawn_locs(position_t * p);
 #endif  // MOVE_GEN_H
@@ -1,295 +1,2125 @@
-#ifndef PRECOMP_TABLES_H
+// Generated by table_generator.c (make precomp_tables.h); do not edit.
 
+#ifndef PRECOMP_TABLES_H
 #define PRECOMP_TABLES_H
-//Precomputed Tables to speedup various methods
-static const double pcentral_table[10][10] = {
-{0.200000, 0.292893, 0.367544, 0.416905, 0.434315, 0.434315, 0.416905, 0.367544, 0.292893, 0.200000},
-{0.292893, 0.400000, 0.490098, 0.552786, 0.575736, 0.575736, 0.552786, 0.490098, 0.400000, 0.292893},
-{0.367544, 0.490098, 0.600000, 0.683772, 0.717157, 0.717157, 0.683772, 0.600000, 0.490098, 0.367544},
-{0.416905, 0.552786, 0.683772, 0.800000, 0.858579, 0.858579, 0.800000, 0.683772, 0.552786, 0.416905},
-{0.434315, 0.575736, 0.717157, 0.858579, 1.000000, 1.000000, 0.858579, 0.717157, 0.575736, 0.434315},
-{0.434315, 0.575736, 0.717157, 0.858579, 1.000000, 1.000000, 0.858579, 0.717157, 0.575736, 0.434315},
-{0.416905, 0.552786, 0.683772, 0.800000, 0.858579, 0.858579, 0.800000, 0.683772, 0.552786, 0.416905},
-{0.367544, 0.490098, 0.600000, 0.683772, 0.717157, 0.717157, 0.683772, 0.600000, 0.490098, 0.367544},
-{0.292893, 0.400000, 0.490098, 0.552786, 0.575736, 0.575736, 0.552786, 0.490098, 0.400000, 0.292893},
-{0.200000, 0.292893, 0.367544, 0.416905, 0.434315, 0.434315, 0.416905, 0.367544, 0.292893, 0.200000},
-};
 
-static const unsigned char square_of_table[13][15] = {
-{'\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', '\xd', '\xe', },
-{'\x10', '\x11', '\x12', '\x13', '\x14', '\x15', '\x16', '\x17', '\x18', '\x19', '\x1a', '\x1b', '\x1c', '\x1d', '\x1e', },
-{'\x20', '\x21', '\x22', '\x23', '\x24', '\x25', '\x26', '\x27', '\x28', '\x29', '\x2a', '\x2b', '\x2c', '\x2d', '\x2e', },
-{'\x30', '\x31', '\x32', '\x33', '\x34', '\x35', '\x36', '\x37', '\x38', '\x39', '\x3a', '\x3b', '\x3c', '\x3d', '\x3e', },
-{'\x40', '\x41', '\x42', '\x43', '\x44', '\x45', '\x46', '\x47', '\x48', '\x49', '\x4a', '\x4b', '\x4c', '\x4d', '\x4e', },
-{'\x50', '\x51', '\x52', '\x53', '\x54', '\x55', '\x56', '\x57', '\x58', '\x59', '\x5a', '\x5b', '\x5c', '\x5d', '\x5e', },
-{'\x60', '\x61', '\x62', '\x63', '\x64', '\x65', '\x66', '\x67', '\x68', '\x69', '\x6a', '\x6b', '\x6c', '\x6d', '\x6e', },
-{'\x70', '\x71', '\x72', '\x73', '\x74', '\x75', '\x76', '\x77', '\x78', '\x79', '\x7a', '\x7b', '\x7c', '\x7d', '\x7e', },
-{'\x80', '\x81', '\x82', '\x83', '\x84', '\x85', '\x86', '\x87', '\x88', '\x89', '\x8a', '\x8b', '\x8c', '\x8d', '\x8e', },
-{'\x90', '\x91', '\x92', '\x93', '\x94', '\x95', '\x96', '\x97', '\x98', '\x99', '\x9a', '\x9b', '\x9c', '\x9d', '\x9e', },
-{'\xa0', '\xa1', '\xa2', '\xa3', '\xa4', '\xa5', '\xa6', '\xa7', '\xa8', '\xa9', '\xaa', '\xab', '\xac', '\xad', '\xae', },
-{'\xb0', '\xb1', '\xb2', '\xb3', '\xb4', '\xb5', '\xb6', '\xb7', '\xb8', '\xb9', '\xba', '\xbb', '\xbc', '\xbd', '\xbe', },
-{'\xc0', '\xc1', '\xc2', '\xc3', '\xc4', '\xc5', '\xc6', '\xc7', '\xc8', '\xc9', '\xca', '\xcb', '\xcc', '\xcd', '\xce', },
+#include <stdint.h>
+
+#define EVAL_TABLE_SHIFT 16
+#define H_DIST_SCALE 2520
+
+// PCENTRAL bonus of a Pawn on (file, rank), fixed point
+static const int32_t pcentral_table[BOARD_WIDTH][BOARD_WIDTH] = {
+  {  13107,  19195,  24087,  27322,  28463,  28463,  27322,  24087,  19195,  13107, },
+  {  19195,  26214,  32119,  36227,  37731,  37731,  36227,  32119,  26214,  19195, },
+  {  24087,  32119,  39322,  44812,  47000,  47000,  44812,  39322,  32119,  24087, },
+  {  27322,  36227,  44812,  52429,  56268,  56268,  52429,  44812,  36227,  27322, },
+  {  28463,  37731,  47000,  56268,  65536,  65536,  56268,  47000,  37731,  28463, },
+  {  28463,  37731,  47000,  56268,  65536,  65536,  56268,  47000,  37731,  28463, },
+  {  27322,  36227,  44812,  52429,  56268,  56268,  52429,  44812,  36227,  27322, },
+  {  24087,  32119,  39322,  44812,  47000,  47000,  44812,  39322,  32119,  24087, },
+  {  19195,  26214,  32119,  36227,  37731,  37731,  36227,  32119,  26214,  19195, },
+  {  13107,  19195,  24087,  27322,  28463,  28463,  27322,  24087,  19195,  13107, },
 };
 
-static const unsigned char fil_of_table[216] = {
-  -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', 
-  -'\x3', -'\x3', -'\x3', -'\x3', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', 
-  -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x1', -'\x1', -'\x1', -'\x1', 
-  -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', 
-  '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', 
-  '\x0', '\x0', '\x0', '\x0', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', 
-  '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x2', '\x2', '\x2', '\x2', 
-  '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', 
-  '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', 
-  '\x3', '\x3', '\x3', '\x3', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', 
-  '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x5', '\x5', '\x5', '\x5', 
-  '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', 
-  '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', 
-  '\x6', '\x6', '\x6', '\x6', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', 
-  '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x8', '\x8', '\x8', '\x8', 
-  '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', 
-  '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', 
-  '\x9', '\x9', '\x9', '\x9', '\xa', '\xa', '\xa', '\xa' 
+// h_dist between two squares, by bitboard index, times H_DIST_SCALE
+static const uint16_t h_dist_table[BB_SQUARES][BB_SQUARES] = {
+  { 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    2880, 1620, 1200,  990,  864,  780,  720,  675,  640,  612,
+    2835, 1575, 1155,  945,  819,  735,  675,  630,  595,  567,
+    2800, 1540, 1120,  910,  784,  700,  640,  595,  560,  532,
+    2772, 1512, 1092,  882,  756,  672,  612,  567,  532,  504, },
+  { 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,  640,
+    1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,  595,
+    1540, 2800, 1540, 1120,  910,  784,  700,  640,  595,  560,
+    1512, 2772, 1512, 1092,  882,  756,  672,  612,  567,  532, },
+  { 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,
+    1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,
+    1120, 1540, 2800, 1540, 1120,  910,  784,  700,  640,  595,
+    1092, 1512, 2772, 1512, 1092,  882,  756,  672,  612,  567, },
+  { 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+     990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,
+     945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,
+     910, 1120, 1540, 2800, 1540, 1120,  910,  784,  700,  640,
+     882, 1092, 1512, 2772, 1512, 1092,  882,  756,  672,  612, },
+  { 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+     864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,
+     819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,
+     784,  910, 1120, 1540, 2800, 1540, 1120,  910,  784,  700,
+     756,  882, 1092, 1512, 2772, 1512, 1092,  882,  756,  672, },
+  { 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,
+     735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,
+     700,  784,  910, 1120, 1540, 2800, 1540, 1120,  910,  784,
+     672,  756,  882, 1092, 1512, 2772, 1512, 1092,  882,  756, },
+  { 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,
+     675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,
+     640,  700,  784,  910, 1120, 1540, 2800, 1540, 1120,  910,
+     612,  672,  756,  882, 1092, 1512, 2772, 1512, 1092,  882, },
+  { 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,
+     630,  675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,
+     595,  640,  700,  784,  910, 1120, 1540, 2800, 1540, 1120,
+     567,  612,  672,  756,  882, 1092, 1512, 2772, 1512, 1092, },
+  { 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     640,  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620,
+     595,  630,  675,  735,  819,  945, 1155, 1575, 2835, 1575,
+     560,  595,  640,  700,  784,  910, 1120, 1540, 2800, 1540,
+     532,  567,  612,  672,  756,  882, 1092, 1512, 2772, 1512, },
+  { 2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     612,  640,  675,  720,  780,  864,  990, 1200, 1620, 2880,
+     567,  595,  630,  675,  735,  819,  945, 1155, 1575, 2835,
+     532,  560,  595,  640,  700,  784,  910, 1120, 1540, 2800,
+     504,  532,  567,  612,  672,  756,  882, 1092, 1512, 2772, },
+  { 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    2880, 1620, 1200,  990,  864,  780,  720,  675,  640,  612,
+    2835, 1575, 1155,  945,  819,  735,  675,  630,  595,  567,
+    2800, 1540, 1120,  910,  784,  700,  640,  595,  560,  532, },
+  { 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,  640,
+    1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,  595,
+    1540, 2800, 1540, 1120,  910,  784,  700,  640,  595,  560, },
+  { 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,
+    1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,
+    1120, 1540, 2800, 1540, 1120,  910,  784,  700,  640,  595, },
+  { 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+     990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,
+     945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,
+     910, 1120, 1540, 2800, 1540, 1120,  910,  784,  700,  640, },
+  { 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+     864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,
+     819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,
+     784,  910, 1120, 1540, 2800, 1540, 1120,  910,  784,  700, },
+  { 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,
+     735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,
+     700,  784,  910, 1120, 1540, 2800, 1540, 1120,  910,  784, },
+  { 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,
+     675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,
+     640,  700,  784,  910, 1120, 1540, 2800, 1540, 1120,  910, },
+  { 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,
+     630,  675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,
+     595,  640,  700,  784,  910, 1120, 1540, 2800, 1540, 1120, },
+  { 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     640,  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620,
+     595,  630,  675,  735,  819,  945, 1155, 1575, 2835, 1575,
+     560,  595,  640,  700,  784,  910, 1120, 1540, 2800, 1540, },
+  { 1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     612,  640,  675,  720,  780,  864,  990, 1200, 1620, 2880,
+     567,  595,  630,  675,  735,  819,  945, 1155, 1575, 2835,
+     532,  560,  595,  640,  700,  784,  910, 1120, 1540, 2800, },
+  { 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    2880, 1620, 1200,  990,  864,  780,  720,  675,  640,  612,
+    2835, 1575, 1155,  945,  819,  735,  675,  630,  595,  567, },
+  { 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,  640,
+    1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,  595, },
+  { 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,
+    1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,  630, },
+  { 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+     990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,
+     945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675, },
+  { 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+     864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,
+     819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735, },
+  { 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,
+     735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819, },
+  { 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,
+     675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945, },
+  { 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,
+     630,  675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155, },
+  { 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     640,  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620,
+     595,  630,  675,  735,  819,  945, 1155, 1575, 2835, 1575, },
+  { 1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     612,  640,  675,  720,  780,  864,  990, 1200, 1620, 2880,
+     567,  595,  630,  675,  735,  819,  945, 1155, 1575, 2835, },
+  { 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    2880, 1620, 1200,  990,  864,  780,  720,  675,  640,  612, },
+  { 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,  640, },
+  { 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675, },
+  { 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+     990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720, },
+  { 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+     864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780, },
+  { 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864, },
+  {  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990, },
+  {  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200, },
+  {  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     640,  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, },
+  {  882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     612,  640,  675,  720,  780,  864,  990, 1200, 1620, 2880, },
+  { 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672, },
+  { 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700, },
+  { 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735, },
+  { 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780, },
+  { 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840, },
+  {  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924, },
+  {  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050, },
+  {  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, },
+  {  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, },
+  {  756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, },
+  { 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756, },
+  { 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784, },
+  { 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819, },
+  { 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864, },
+  {  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924, },
+  {  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008, },
+  {  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, },
+  {  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, },
+  {  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, },
+  {  672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, },
+  { 2880, 1620, 1200,  990,  864,  780,  720,  675,  640,  612,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882, },
+  { 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,  640,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910, },
+  { 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945, },
+  {  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990, },
+  {  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050, },
+  {  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, },
+  {  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, },
+  {  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, },
+  {  640,  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, },
+  {  612,  640,  675,  720,  780,  864,  990, 1200, 1620, 2880,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, },
+  { 2835, 1575, 1155,  945,  819,  735,  675,  630,  595,  567,
+    2880, 1620, 1200,  990,  864,  780,  720,  675,  640,  612,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092, },
+  { 1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,  595,
+    1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,  640,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, },
+  { 1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,
+    1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, },
+  {  945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,
+     990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, },
+  {  819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,
+     864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, },
+  {  735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,
+     780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, },
+  {  675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,
+     720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, },
+  {  630,  675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,
+     675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, },
+  {  595,  630,  675,  735,  819,  945, 1155, 1575, 2835, 1575,
+     640,  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, },
+  {  567,  595,  630,  675,  735,  819,  945, 1155, 1575, 2835,
+     612,  640,  675,  720,  780,  864,  990, 1200, 1620, 2880,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, },
+  { 2800, 1540, 1120,  910,  784,  700,  640,  595,  560,  532,
+    2835, 1575, 1155,  945,  819,  735,  675,  630,  595,  567,
+    2880, 1620, 1200,  990,  864,  780,  720,  675,  640,  612,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512, },
+  { 1540, 2800, 1540, 1120,  910,  784,  700,  640,  595,  560,
+    1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,  595,
+    1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,  640,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, },
+  { 1120, 1540, 2800, 1540, 1120,  910,  784,  700,  640,  595,
+    1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,
+    1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, },
+  {  910, 1120, 1540, 2800, 1540, 1120,  910,  784,  700,  640,
+     945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,
+     990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, },
+  {  784,  910, 1120, 1540, 2800, 1540, 1120,  910,  784,  700,
+     819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,
+     864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, },
+  {  700,  784,  910, 1120, 1540, 2800, 1540, 1120,  910,  784,
+     735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,
+     780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, },
+  {  640,  700,  784,  910, 1120, 1540, 2800, 1540, 1120,  910,
+     675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,
+     720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, },
+  {  595,  640,  700,  784,  910, 1120, 1540, 2800, 1540, 1120,
+     630,  675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,
+     675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, },
+  {  560,  595,  640,  700,  784,  910, 1120, 1540, 2800, 1540,
+     595,  630,  675,  735,  819,  945, 1155, 1575, 2835, 1575,
+     640,  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, },
+  {  532,  560,  595,  640,  700,  784,  910, 1120, 1540, 2800,
+     567,  595,  630,  675,  735,  819,  945, 1155, 1575, 2835,
+     612,  640,  675,  720,  780,  864,  990, 1200, 1620, 2880,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, },
+  { 2772, 1512, 1092,  882,  756,  672,  612,  567,  532,  504,
+    2800, 1540, 1120,  910,  784,  700,  640,  595,  560,  532,
+    2835, 1575, 1155,  945,  819,  735,  675,  630,  595,  567,
+    2880, 1620, 1200,  990,  864,  780,  720,  675,  640,  612,
+    2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,  672,
+    3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,  756,
+    3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,  882,
+    3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120, 1092,
+    3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540, 1512,
+    5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, 2772, },
+  { 1512, 2772, 1512, 1092,  882,  756,  672,  612,  567,  532,
+    1540, 2800, 1540, 1120,  910,  784,  700,  640,  595,  560,
+    1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,  595,
+    1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,  640,
+    1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,  700,
+    1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,  784,
+    1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,  910,
+    2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155, 1120,
+    2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575, 1540,
+    3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, 2800, },
+  { 1092, 1512, 2772, 1512, 1092,  882,  756,  672,  612,  567,
+    1120, 1540, 2800, 1540, 1120,  910,  784,  700,  640,  595,
+    1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,  630,
+    1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,  675,
+    1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,  735,
+    1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,  819,
+    1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,  945,
+    1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200, 1155,
+    2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620, 1575,
+    3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, 2835, },
+  {  882, 1092, 1512, 2772, 1512, 1092,  882,  756,  672,  612,
+     910, 1120, 1540, 2800, 1540, 1120,  910,  784,  700,  640,
+     945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,  675,
+     990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,  720,
+    1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,  780,
+    1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,  864,
+    1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,  990,
+    1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260, 1200,
+    1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680, 1620,
+    3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, 2880, },
+  {  756,  882, 1092, 1512, 2772, 1512, 1092,  882,  756,  672,
+     784,  910, 1120, 1540, 2800, 1540, 1120,  910,  784,  700,
+     819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,  735,
+     864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,  780,
+     924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,  840,
+    1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,  924,
+    1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134, 1050,
+    1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344, 1260,
+    1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764, 1680,
+    3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, 2940, },
+  {  672,  756,  882, 1092, 1512, 2772, 1512, 1092,  882,  756,
+     700,  784,  910, 1120, 1540, 2800, 1540, 1120,  910,  784,
+     735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,  819,
+     780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,  864,
+     840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,  924,
+     924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134, 1008,
+    1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260, 1134,
+    1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470, 1344,
+    1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890, 1764,
+    2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, 3024, },
+  {  612,  672,  756,  882, 1092, 1512, 2772, 1512, 1092,  882,
+     640,  700,  784,  910, 1120, 1540, 2800, 1540, 1120,  910,
+     675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,  945,
+     720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,  990,
+     780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260, 1050,
+     864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344, 1134,
+     990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470, 1260,
+    1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680, 1470,
+    1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100, 1890,
+    2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, 3150, },
+  {  567,  612,  672,  756,  882, 1092, 1512, 2772, 1512, 1092,
+     595,  640,  700,  784,  910, 1120, 1540, 2800, 1540, 1120,
+     630,  675,  735,  819,  945, 1155, 1575, 2835, 1575, 1155,
+     675,  720,  780,  864,  990, 1200, 1620, 2880, 1620, 1200,
+     735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680, 1260,
+     819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764, 1344,
+     945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890, 1470,
+    1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100, 1680,
+    1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520, 2100,
+    2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, 3360, },
+  {  532,  567,  612,  672,  756,  882, 1092, 1512, 2772, 1512,
+     560,  595,  640,  700,  784,  910, 1120, 1540, 2800, 1540,
+     595,  630,  675,  735,  819,  945, 1155, 1575, 2835, 1575,
+     640,  675,  720,  780,  864,  990, 1200, 1620, 2880, 1620,
+     700,  735,  780,  840,  924, 1050, 1260, 1680, 2940, 1680,
+     784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024, 1764,
+     910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150, 1890,
+    1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360, 2100,
+    1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780, 2520,
+    2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, 3780, },
+  {  504,  532,  567,  612,  672,  756,  882, 1092, 1512, 2772,
+     532,  560,  595,  640,  700,  784,  910, 1120, 1540, 2800,
+     567,  595,  630,  675,  735,  819,  945, 1155, 1575, 2835,
+     612,  640,  675,  720,  780,  864,  990, 1200, 1620, 2880,
+     672,  700,  735,  780,  840,  924, 1050, 1260, 1680, 2940,
+     756,  784,  819,  864,  924, 1008, 1134, 1344, 1764, 3024,
+     882,  910,  945,  990, 1050, 1134, 1260, 1470, 1890, 3150,
+    1092, 1120, 1155, 1200, 1260, 1344, 1470, 1680, 2100, 3360,
+    1512, 1540, 1575, 1620, 1680, 1764, 1890, 2100, 2520, 3780,
+    2772, 2800, 2835, 2880, 2940, 3024, 3150, 3360, 3780, 5040, },
 };
 
-static const unsigned char rnk_of_table[216] = {
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', 
-  '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', 
-  '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', 
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', 
-  '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', 
-  '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', 
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', 
-  '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', 
-  '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', 
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', 
-  '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', 
-  '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', 
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0' 
+// KFACE bonus of a King with orientation ori, when the other King is
+// delta_fil files and delta_rnk ranks away:
+//   kface_table[ori][delta_fil + BOARD_WIDTH - 1][delta_rnk + BOARD_WIDTH - 1]
+// fixed point
+static const int32_t kface_table[NUM_ORI][2 * BOARD_WIDTH - 1][2 * BOARD_WIDTH - 1] = {
+  {
+    { -32768, -30840, -28672, -26214, -23406, -20165, -16384, -11916,  -6554,      0,   6554,  11916,  16384,  20165,  23406,  26214,  28672,  30840,  32768, },
+    { -34696, -32768, -30583, -28087, -25206, -21845, -17873, -13107,  -7282,      0,   7282,  13107,  17873,  21845,  25206,  28087,  30583,  32768,  34696, },
+    { -36864, -34953, -32768, -30247, -27307, -23831, -19661, -14564,  -8192,      0,   8192,  14564,  19661,  23831,  27307,  30247,  32768,  34953,  36864, },
+    { -39322, -37449, -35289, -32768, -29789, -26214, -21845, -16384,  -9362,      0,   9362,  16384,  21845,  26214,  29789,  32768,  35289,  37449,  39322, },
+    { -42130, -40330, -38229, -35747, -32768, -29127, -24576, -18725, -10923,      0,  10923,  18725,  24576,  29127,  32768,  35747,  38229,  40330,  42130, },
+    { -45371, -43691, -41705, -39322, -36409, -32768, -28087, -21845, -13107,      0,  13107,  21845,  28087,  32768,  36409,  39322,  41705,  43691,  45371, },
+    { -49152, -47663, -45875, -43691, -40960, -37449, -32768, -26214, -16384,      0,  16384,  26214,  32768,  37449,  40960,  43691,  45875,  47663,  49152, },
+    { -53620, -52429, -50972, -49152, -46811, -43691, -39322, -32768, -21845,      0,  21845,  32768,  39322,  43691,  46811,  49152,  50972,  52429,  53620, },
+    { -58982, -58254, -57344, -56174, -54613, -52429, -49152, -43691, -32768,      0,  32768,  43691,  49152,  52429,  54613,  56174,  57344,  58254,  58982, },
+    { -65536, -65536, -65536, -65536, -65536, -65536, -65536, -65536, -65536,      0,  65536,  65536,  65536,  65536,  65536,  65536,  65536,  65536,  65536, },
+    { -58982, -58254, -57344, -56174, -54613, -52429, -49152, -43691, -32768,      0,  32768,  43691,  49152,  52429,  54613,  56174,  57344,  58254,  58982, },
+    { -53620, -52429, -50972, -49152, -46811, -43691, -39322, -32768, -21845,      0,  21845,  32768,  39322,  43691,  46811,  49152,  50972,  52429,  53620, },
+    { -49152, -47663, -45875, -43691, -40960, -37449, -32768, -26214, -16384,      0,  16384,  26214,  32768,  37449,  40960,  43691,  45875,  47663,  49152, },
+    { -45371, -43691, -41705, -39322, -36409, -32768, -28087, -21845, -13107,      0,  13107,  21845,  28087,  32768,  36409,  39322,  41705,  43691,  45371, },
+    { -42130, -40330, -38229, -35747, -32768, -29127, -24576, -18725, -10923,      0,  10923,  18725,  24576,  29127,  32768,  35747,  38229,  40330,  42130, },
+    { -39322, -37449, -35289, -32768, -29789, -26214, -21845, -16384,  -9362,      0,   9362,  16384,  21845,  26214,  29789,  32768,  35289,  37449,  39322, },
+    { -36864, -34953, -32768, -30247, -27307, -23831, -19661, -14564,  -8192,      0,   8192,  14564,  19661,  23831,  27307,  30247,  32768,  34953,  36864, },
+    { -34696, -32768, -30583, -28087, -25206, -21845, -17873, -13107,  -7282,      0,   7282,  13107,  17873,  21845,  25206,  28087,  30583,  32768,  34696, },
+    { -32768, -30840, -28672, -26214, -23406, -20165, -16384, -11916,  -6554,      0,   6554,  11916,  16384,  20165,  23406,  26214,  28672,  30840,  32768, },
+  },
+  {
+    { -32768, -34696, -36864, -39322, -42130, -45371, -49152, -53620, -58982, -65536, -58982, -53620, -49152, -45371, -42130, -39322, -36864, -34696, -32768, },
+    { -30840, -32768, -34953, -37449, -40330, -43691, -47663, -52429, -58254, -65536, -58254, -52429, -47663, -43691, -40330, -37449, -34953, -32768, -30840, },
+    { -28672, -30583, -32768, -35289, -38229, -41705, -45875, -50972, -57344, -65536, -57344, -50972, -45875, -41705, -38229, -35289, -32768, -30583, -28672, },
+    { -26214, -28087, -30247, -32768, -35747, -39322, -43691, -49152, -56174, -65536, -56174, -49152, -43691, -39322, -35747, -32768, -30247, -28087, -26214, },
+    { -23406, -25206, -27307, -29789, -32768, -36409, -40960, -46811, -54613, -65536, -54613, -46811, -40960, -36409, -32768, -29789, -27307, -25206, -23406, },
+    { -20165, -21845, -23831, -26214, -29127, -32768, -37449, -43691, -52429, -65536, -52429, -43691, -37449, -32768, -29127, -26214, -23831, -21845, -20165, },
+    { -16384, -17873, -19661, -21845, -24576, -28087, -32768, -39322, -49152, -65536, -49152, -39322, -32768, -28087, -24576, -21845, -19661, -17873, -16384, },
+    { -11916, -13107, -14564, -16384, -18725, -21845, -26214, -32768, -43691, -65536, -43691, -32768, -26214, -21845, -18725, -16384, -14564, -13107, -11916, },
+    {  -6554,  -7282,  -8192,  -9362, -10923, -13107, -16384, -21845, -32768, -65536, -32768, -21845, -16384, -13107, -10923,  -9362,  -8192,  -7282,  -6554, },
+    {      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0, },
+    {   6554,   7282,   8192,   9362,  10923,  13107,  16384,  21845,  32768,  65536,  32768,  21845,  16384,  13107,  10923,   9362,   8192,   7282,   6554, },
+    {  11916,  13107,  14564,  16384,  18725,  21845,  26214,  32768,  43691,  65536,  43691,  32768,  26214,  21845,  18725,  16384,  14564,  13107,  11916, },
+    {  16384,  17873,  19661,  21845,  24576,  28087,  32768,  39322,  49152,  65536,  49152,  39322,  32768,  28087,  24576,  21845,  19661,  17873,  16384, },
+    {  20165,  21845,  23831,  26214,  29127,  32768,  37449,  43691,  52429,  65536,  52429,  43691,  37449,  32768,  29127,  26214,  23831,  21845,  20165, },
+    {  23406,  25206,  27307,  29789,  32768,  36409,  40960,  46811,  54613,  65536,  54613,  46811,  40960,  36409,  32768,  29789,  27307,  25206,  23406, },
+    {  26214,  28087,  30247,  32768,  35747,  39322,  43691,  49152,  56174,  65536,  56174,  49152,  43691,  39322,  35747,  32768,  30247,  28087,  26214, },
+    {  28672,  30583,  32768,  35289,  38229,  41705,  45875,  50972,  57344,  65536,  57344,  50972,  45875,  41705,  38229,  35289,  32768,  30583,  28672, },
+    {  30840,  32768,  34953,  37449,  40330,  43691,  47663,  52429,  58254,  65536,  58254,  52429,  47663,  43691,  40330,  37449,  34953,  32768,  30840, },
+    {  32768,  34696,  36864,  39322,  42130,  45371,  49152,  53620,  58982,  65536,  58982,  53620,  49152,  45371,  42130,  39322,  36864,  34696,  32768, },
+  },
+  {
+    {  32768,  30840,  28672,  26214,  23406,  20165,  16384,  11916,   6554,      0,  -6554, -11916, -16384, -20165, -23406, -26214, -28672, -30840, -32768, },
+    {  34696,  32768,  30583,  28087,  25206,  21845,  17873,  13107,   7282,      0,  -7282, -13107, -17873, -21845, -25206, -28087, -30583, -32768, -34696, },
+    {  36864,  34953,  32768,  30247,  27307,  23831,  19661,  14564,   8192,      0,  -8192, -14564, -19661, -23831, -27307, -30247, -32768, -34953, -36864, },
+    {  39322,  37449,  35289,  32768,  29789,  26214,  21845,  16384,   9362,      0,  -9362, -16384, -21845, -26214, -29789, -32768, -35289, -37449, -39322, },
+    {  42130,  40330,  38229,  35747,  32768,  29127,  24576,  18725,  10923,      0, -10923, -18725, -24576, -29127, -32768, -35747, -38229, -40330, -42130, },
+    {  45371,  43691,  41705,  39322,  36409,  32768,  28087,  21845,  13107,      0, -13107, -21845, -28087, -32768, -36409, -39322, -41705, -43691, -45371, },
+    {  49152,  47663,  45875,  43691,  40960,  37449,  32768,  26214,  16384,      0, -16384, -26214, -32768, -37449, -40960, -43691, -45875, -47663, -49152, },
+    {  53620,  52429,  50972,  49152,  46811,  43691,  39322,  32768,  21845,      0, -21845, -32768, -39322, -43691, -46811, -49152, -50972, -52429, -53620, },
+    {  58982,  58254,  57344,  56174,  54613,  52429,  49152,  43691,  32768,      0, -32768, -43691, -49152, -52429, -54613, -56174, -57344, -58254, -58982, },
+    {  65536,  65536,  65536,  65536,  65536,  65536,  65536,  65536,  65536,      0, -65536, -65536, -65536, -65536, -65536, -65536, -65536, -65536, -65536, },
+    {  58982,  58254,  57344,  56174,  54613,  52429,  49152,  43691,  32768,      0, -32768, -43691, -49152, -52429, -54613, -56174, -57344, -58254, -58982, },
+    {  53620,  52429,  50972,  49152,  46811,  43691,  39322,  32768,  21845,      0, -21845, -32768, -39322, -43691, -46811, -49152, -50972, -52429, -53620, },
+    {  49152,  47663,  45875,  43691,  40960,  37449,  32768,  26214,  16384,      0, -16384, -26214, -32768, -37449, -40960, -43691, -45875, -47663, -49152, },
+    {  45371,  43691,  41705,  39322,  36409,  32768,  28087,  21845,  13107,      0, -13107, -21845, -28087, -32768, -36409, -39322, -41705, -43691, -45371, },
+    {  42130,  40330,  38229,  35747,  32768,  29127,  24576,  18725,  10923,      0, -10923, -18725, -24576, -29127, -32768, -35747, -38229, -40330, -42130, },
+    {  39322,  37449,  35289,  32768,  29789,  26214,  21845,  16384,   9362,      0,  -9362, -16384, -21845, -26214, -29789, -32768, -35289, -37449, -39322, },
+    {  36864,  34953,  32768,  30247,  27307,  23831,  19661,  14564,   8192,      0,  -8192, -14564, -19661, -23831, -27307, -30247, -32768, -34953, -36864, },
+    {  34696,  32768,  30583,  28087,  25206,  21845,  17873,  13107,   7282,      0,  -7282, -13107, -17873, -21845, -25206, -28087, -30583, -32768, -34696, },
+    {  32768,  30840,  28672,  26214,  23406,  20165,  16384,  11916,   6554,      0,  -6554, -11916, -16384, -20165, -23406, -26214, -28672, -30840, -32768, },
+  },
+  {
+    {  32768,  34696,  36864,  39322,  42130,  45371,  49152,  53620,  58982,  65536,  58982,  53620,  49152,  45371,  42130,  39322,  36864,  34696,  32768, },
+    {  30840,  32768,  34953,  37449,  40330,  43691,  47663,  52429,  58254,  65536,  58254,  52429,  47663,  43691,  40330,  37449,  34953,  32768,  30840, },
+    {  28672,  30583,  32768,  35289,  38229,  41705,  45875,  50972,  57344,  65536,  57344,  50972,  45875,  41705,  38229,  35289,  32768,  30583,  28672, },
+    {  26214,  28087,  30247,  32768,  35747,  39322,  43691,  49152,  56174,  65536,  56174,  49152,  43691,  39322,  35747,  32768,  30247,  28087,  26214, },
+    {  23406,  25206,  27307,  29789,  32768,  36409,  40960,  46811,  54613,  65536,  54613,  46811,  40960,  36409,  32768,  29789,  27307,  25206,  23406, },
+    {  20165,  21845,  23831,  26214,  29127,  32768,  37449,  43691,  52429,  65536,  52429,  43691,  37449,  32768,  29127,  26214,  23831,  21845,  20165, },
+    {  16384,  17873,  19661,  21845,  24576,  28087,  32768,  39322,  49152,  65536,  49152,  39322,  32768,  28087,  24576,  21845,  19661,  17873,  16384, },
+    {  11916,  13107,  14564,  16384,  18725,  21845,  26214,  32768,  43691,  65536,  43691,  32768,  26214,  21845,  18725,  16384,  14564,  13107,  11916, },
+    {   6554,   7282,   8192,   9362,  10923,  13107,  16384,  21845,  32768,  65536,  32768,  21845,  16384,  13107,  10923,   9362,   8192,   7282,   6554, },
+    {      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0, },
+    {  -6554,  -7282,  -8192,  -9362, -10923, -13107, -16384, -21845, -32768, -65536, -32768, -21845, -16384, -13107, -10923,  -9362,  -8192,  -7282,  -6554, },
+    { -11916, -13107, -14564, -16384, -18725, -21845, -26214, -32768, -43691, -65536, -43691, -32768, -26214, -21845, -18725, -16384, -14564, -13107, -11916, },
+    { -16384, -17873, -19661, -21845, -24576, -28087, -32768, -39322, -49152, -65536, -49152, -39322, -32768, -28087, -24576, -21845, -19661, -17873, -16384, },
+    { -20165, -21845, -23831, -26214, -29127, -32768, -37449, -43691, -52429, -65536, -52429, -43691, -37449, -32768, -29127, -26214, -23831, -21845, -20165, },
+    { -23406, -25206, -27307, -29789, -32768, -36409, -40960, -46811, -54613, -65536, -54613, -46811, -40960, -36409, -32768, -29789, -27307, -25206, -23406, },
+    { -26214, -28087, -30247, -32768, -35747, -39322, -43691, -49152, -56174, -65536, -56174, -49152, -43691, -39322, -35747, -32768, -30247, -28087, -26214, },
+    { -28672, -30583, -32768, -35289, -38229, -41705, -45875, -50972, -57344, -65536, -57344, -50972, -45875, -41705, -38229, -35289, -32768, -30583, -28672, },
+    { -30840, -32768, -34953, -37449, -40330, -43691, -47663, -52429, -58254, -65536, -58254, -52429, -47663, -43691, -40330, -37449, -34953, -32768, -30840, },
+    { -32768, -34696, -36864, -39322, -42130, -45371, -49152, -53620, -58982, -65536, -58982, -53620, -49152, -45371, -42130, -39322, -36864, -34696, -32768, },
+  },
 };
 
-static const float h_dist_table[216][216] = {
-{2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.139423, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, },
-{1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, },
-{1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, },
-{1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, },
-{1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, },
-{1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, },
-{1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, },
-{1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.196429, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, },
-{1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.182540, 0.196429, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, },
-{1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.171429, 0.182540, 0.196429, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, },
-{1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.162338, 0.171429, 0.182540, 0.196429, 0.214286, 0.238095, 0.271429, 0.321429, },
-{1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.154762, 0.162338, 0.171429, 0.182540, 0.196429, 0.214286, 0.238095, 0.271429, },
-{1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.148352, 0.154762, 0.162338, 0.171429, 0.182540, 0.196429, 0.214286, 0.238095, },
-{1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.142857, 0.148352, 0.154762, 0.162338, 0.171429, 0.182540, 0.196429, 0.214286, },
-{1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.138095, 0.142857, 0.148352, 0.154762, 0.162338, 0.171429, 0.182540, 0.196429, },
-{1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.139423, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.133929, 0.138095, 0.142857, 0.148352, 0.154762, 0.162338, 0.171429, 0.182540, },
-{1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, },
-{1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, },
-{0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, },
-{0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, },
-{0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, },
-{0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, },
-{0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, },
-{0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, },
-{0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, },
-{0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, },
-{0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, },
-{0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, },
-{0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, },
-{0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, },
-{0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, },
-{0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.139423, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, },
-{1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, },
-{0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, },
-{0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, },
-{0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, },
-{0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, },
-{0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, },
-{0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, },
-{0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, },
-{0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, },
-{0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, },
-{0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, },
-{0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, },
-{0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, },
-{0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, },
-{0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, },
-{0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, },
-{1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, },
-{0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, },
-{0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, },
-{0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, },
-{0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, },
-{0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, },
-{0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, },
-{0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, },
-{0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, },
-{0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, },
-{0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, },
-{0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, },
-{0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, },
-{0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, },
-{0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, },
-{0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, },
-{1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, },
-{0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, },
-{0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, },
-{0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, },
-{0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, },
-{0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, },
-{0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, },
-{0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, },
-{0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, },
-{0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, },
-{0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, },
-{0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, },
-{0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, },
-{0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, },
-{0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, },
-{0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, },
-{1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, },
-{0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, },
-{0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, },
-{0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, },
-{0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, },
-{0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, },
-{0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, },
-{0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, },
-{0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, },
-{0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, },
-{0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, },
-{0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, },
-{0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, },
-{0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, },
-{0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, },
-{0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, },
-{1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, },
-{0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, },
-{0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, },
-{0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, },
-{0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, },
-{0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, },
-{0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, },
-{0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, },
-{0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, },
-{0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, },
-{0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, },
-{0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, },
-{0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, },
-{0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, },
-{0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, },
-{0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, },
-{1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, },
-{0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, },
-{0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, },
-{0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, },
-{0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, },
-{0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, },
-{0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, },
-{0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, },
-{0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, },
-{0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, },
-{0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, },
-{0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, },
-{0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, },
-{0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, },
-{0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, },
-{0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, },
-{1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, },
-{0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, },
-{0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, },
-{0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, },
-{0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, },
-{0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, },
-{0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, },
-{0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, },
-{0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, },
-{0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, },
-{0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, },
-{0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, },
-{0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, },
-{0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, },
-{0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, },
-{0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, },
-{1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, },
-{0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, },
-{0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, },
-{0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, },
-{0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, },
-{0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, },
-{0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, },
-{0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, },
-{0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, },
-{0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, },
-{0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, },
-{0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, },
-{0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, },
-{0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, },
-{0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, },
-{0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, },
-{1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, },
-{0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, },
-{0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, },
-{0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, },
-{0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, },
-{0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, },
-{0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, },
-{0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, },
-{0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, },
-{0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, },
-{0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, },
-{0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, },
-{0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, },
-{0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, },
-{0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, },
-{0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, },
-{1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, },
-{0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, },
-{0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, },
-{0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, },
-{0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, },
-{0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, },
-{0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, },
-{0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, },
-{0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, },
-{0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, },
-{0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, },
-{0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, },
-{0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, },
-{0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, },
-{0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, },
-{0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, },
-{1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.139423, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, },
-{0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, },
-{0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, },
-{0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, },
-{0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, },
-{0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, },
-{0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, },
-{0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, },
-{0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, },
-{0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, },
-{0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, },
-{0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, },
-{0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, },
-{0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, },
-{0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, },
-{0.139423, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, },
-{1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.148352, 0.142857, 0.138095, 0.133929, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.139423, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, },
-{0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.148352, 0.142857, 0.138095, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, },
-{0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.148352, 0.142857, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, },
-{0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.148352, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, },
-{0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, },
-{0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, },
-{0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, },
-{0.196429, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, },
+// KAGGRESSIVE bonus of a King when the other King is on another square,
+// both by bitboard index, fixed point
+static const int32_t kaggressive_table[BB_SQUARES][BB_SQUARES] = {
+  {   655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655, },
+  {  5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, },
+  {  5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, },
+  {  4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621, },
+  {  3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277, },
+  {  3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932, },
+  {  2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588, },
+  {  1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243, },
+  {  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898, },
+  {   655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554, },
+  {  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, },
+  { 53084, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, },
+  { 47186, 47186, 17695, 17695, 17695, 17695, 17695, 17695, 17695, 17695,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, },
+  { 41288, 41288, 41288, 23593, 23593, 23593, 23593, 23593, 23593, 23593,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243, },
+  { 35389, 35389, 35389, 35389, 29491, 29491, 29491, 29491, 29491, 29491,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554, },
+  { 29491, 29491, 29491, 29491, 29491, 35389, 35389, 35389, 35389, 35389,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864, },
+  { 23593, 23593, 23593, 23593, 23593, 23593, 41288, 41288, 41288, 41288,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175, },
+  { 17695, 17695, 17695, 17695, 17695, 17695, 17695, 47186, 47186, 47186,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486, },
+  { 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 53084, 53084,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796, },
+  {  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898, 58982,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107, },
+  {  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, },
+  { 47186, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    47186, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, },
+  { 41943, 41943, 15729, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    41943, 41943, 15729, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898, },
+  { 36700, 36700, 36700, 20972, 20972, 20972, 20972, 20972, 20972, 20972,
+    36700, 36700, 36700, 20972, 20972, 20972, 20972, 20972, 20972, 20972,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864, },
+  { 31457, 31457, 31457, 31457, 26214, 26214, 26214, 26214, 26214, 26214,
+    31457, 31457, 31457, 31457, 26214, 26214, 26214, 26214, 26214, 26214,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830, },
+  { 26214, 26214, 26214, 26214, 26214, 31457, 31457, 31457, 31457, 31457,
+    26214, 26214, 26214, 26214, 26214, 31457, 31457, 31457, 31457, 31457,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796, },
+  { 20972, 20972, 20972, 20972, 20972, 20972, 36700, 36700, 36700, 36700,
+    20972, 20972, 20972, 20972, 20972, 20972, 36700, 36700, 36700, 36700,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763, },
+  { 15729, 15729, 15729, 15729, 15729, 15729, 15729, 41943, 41943, 41943,
+    15729, 15729, 15729, 15729, 15729, 15729, 15729, 41943, 41943, 41943,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729, },
+  { 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 47186, 47186,
+    10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 47186, 47186,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695, },
+  {  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 52429,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 52429,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661, },
+  {  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, },
+  { 41288,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,
+    41288,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,
+    41288,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, },
+  { 36700, 36700, 13763, 13763, 13763, 13763, 13763, 13763, 13763, 13763,
+    36700, 36700, 13763, 13763, 13763, 13763, 13763, 13763, 13763, 13763,
+    36700, 36700, 13763, 13763, 13763, 13763, 13763, 13763, 13763, 13763,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, },
+  { 32113, 32113, 32113, 18350, 18350, 18350, 18350, 18350, 18350, 18350,
+    32113, 32113, 32113, 18350, 18350, 18350, 18350, 18350, 18350, 18350,
+    32113, 32113, 32113, 18350, 18350, 18350, 18350, 18350, 18350, 18350,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486, },
+  { 27525, 27525, 27525, 27525, 22938, 22938, 22938, 22938, 22938, 22938,
+    27525, 27525, 27525, 27525, 22938, 22938, 22938, 22938, 22938, 22938,
+    27525, 27525, 27525, 27525, 22938, 22938, 22938, 22938, 22938, 22938,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107, },
+  { 22938, 22938, 22938, 22938, 22938, 27525, 27525, 27525, 27525, 27525,
+    22938, 22938, 22938, 22938, 22938, 27525, 27525, 27525, 27525, 27525,
+    22938, 22938, 22938, 22938, 22938, 27525, 27525, 27525, 27525, 27525,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729, },
+  { 18350, 18350, 18350, 18350, 18350, 18350, 32113, 32113, 32113, 32113,
+    18350, 18350, 18350, 18350, 18350, 18350, 32113, 32113, 32113, 32113,
+    18350, 18350, 18350, 18350, 18350, 18350, 32113, 32113, 32113, 32113,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350, },
+  { 13763, 13763, 13763, 13763, 13763, 13763, 13763, 36700, 36700, 36700,
+    13763, 13763, 13763, 13763, 13763, 13763, 13763, 36700, 36700, 36700,
+    13763, 13763, 13763, 13763, 13763, 13763, 13763, 36700, 36700, 36700,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972, },
+  {  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175, 41288, 41288,
+     9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175, 41288, 41288,
+     9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175, 41288, 41288,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593, },
+  {  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588, 45875,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588, 45875,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588, 45875,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214, },
+  {  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, },
+  { 35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, },
+  { 31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830, },
+  { 27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107, },
+  { 23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661,
+    23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661,
+    23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661,
+    23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384, },
+  { 19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593,
+    19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593,
+    19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593,
+    19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661, },
+  { 15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525,
+    15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525,
+    15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525,
+    15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938, },
+  { 11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214, },
+  {  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491, },
+  {  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768, },
+  {  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, },
+  { 29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    29491,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
+    35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    35389,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, },
+  { 26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    26214, 26214,  9830,  9830,  9830,  9830,  9830,  9830,  9830,  9830,
+    31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    31457, 31457, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796, },
+  { 22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    22938, 22938, 22938, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+    27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    27525, 27525, 27525, 15729, 15729, 15729, 15729, 15729, 15729, 15729, },
+  { 19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    19661, 19661, 19661, 19661, 16384, 16384, 16384, 16384, 16384, 16384,
+    23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661,
+    23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661,
+    23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661,
+    23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661,
+    23593, 23593, 23593, 23593, 19661, 19661, 19661, 19661, 19661, 19661, },
+  { 16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    16384, 16384, 16384, 16384, 16384, 19661, 19661, 19661, 19661, 19661,
+    19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593,
+    19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593,
+    19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593,
+    19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593,
+    19661, 19661, 19661, 19661, 19661, 23593, 23593, 23593, 23593, 23593, },
+  { 13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    13107, 13107, 13107, 13107, 13107, 13107, 22938, 22938, 22938, 22938,
+    15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525,
+    15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525,
+    15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525,
+    15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525,
+    15729, 15729, 15729, 15729, 15729, 15729, 27525, 27525, 27525, 27525, },
+  {  9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+     9830,  9830,  9830,  9830,  9830,  9830,  9830, 26214, 26214, 26214,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 31457, 31457, 31457, },
+  {  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 29491, 29491,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864, 35389, 35389, },
+  {  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277,  3277, 32768,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 39322, },
+  {  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588, },
+  { 23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    23593,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    41288,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,
+    41288,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,
+    41288,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,
+    41288,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175, },
+  { 20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    20972, 20972,  7864,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    36700, 36700, 13763, 13763, 13763, 13763, 13763, 13763, 13763, 13763,
+    36700, 36700, 13763, 13763, 13763, 13763, 13763, 13763, 13763, 13763,
+    36700, 36700, 13763, 13763, 13763, 13763, 13763, 13763, 13763, 13763,
+    36700, 36700, 13763, 13763, 13763, 13763, 13763, 13763, 13763, 13763, },
+  { 18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    18350, 18350, 18350, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    32113, 32113, 32113, 18350, 18350, 18350, 18350, 18350, 18350, 18350,
+    32113, 32113, 32113, 18350, 18350, 18350, 18350, 18350, 18350, 18350,
+    32113, 32113, 32113, 18350, 18350, 18350, 18350, 18350, 18350, 18350,
+    32113, 32113, 32113, 18350, 18350, 18350, 18350, 18350, 18350, 18350, },
+  { 15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    15729, 15729, 15729, 15729, 13107, 13107, 13107, 13107, 13107, 13107,
+    27525, 27525, 27525, 27525, 22938, 22938, 22938, 22938, 22938, 22938,
+    27525, 27525, 27525, 27525, 22938, 22938, 22938, 22938, 22938, 22938,
+    27525, 27525, 27525, 27525, 22938, 22938, 22938, 22938, 22938, 22938,
+    27525, 27525, 27525, 27525, 22938, 22938, 22938, 22938, 22938, 22938, },
+  { 13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    13107, 13107, 13107, 13107, 13107, 15729, 15729, 15729, 15729, 15729,
+    22938, 22938, 22938, 22938, 22938, 27525, 27525, 27525, 27525, 27525,
+    22938, 22938, 22938, 22938, 22938, 27525, 27525, 27525, 27525, 27525,
+    22938, 22938, 22938, 22938, 22938, 27525, 27525, 27525, 27525, 27525,
+    22938, 22938, 22938, 22938, 22938, 27525, 27525, 27525, 27525, 27525, },
+  { 10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    10486, 10486, 10486, 10486, 10486, 10486, 18350, 18350, 18350, 18350,
+    18350, 18350, 18350, 18350, 18350, 18350, 32113, 32113, 32113, 32113,
+    18350, 18350, 18350, 18350, 18350, 18350, 32113, 32113, 32113, 32113,
+    18350, 18350, 18350, 18350, 18350, 18350, 32113, 32113, 32113, 32113,
+    18350, 18350, 18350, 18350, 18350, 18350, 32113, 32113, 32113, 32113, },
+  {  7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+     7864,  7864,  7864,  7864,  7864,  7864,  7864, 20972, 20972, 20972,
+    13763, 13763, 13763, 13763, 13763, 13763, 13763, 36700, 36700, 36700,
+    13763, 13763, 13763, 13763, 13763, 13763, 13763, 36700, 36700, 36700,
+    13763, 13763, 13763, 13763, 13763, 13763, 13763, 36700, 36700, 36700,
+    13763, 13763, 13763, 13763, 13763, 13763, 13763, 36700, 36700, 36700, },
+  {  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 23593, 23593,
+     9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175, 41288, 41288,
+     9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175, 41288, 41288,
+     9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175, 41288, 41288,
+     9175,  9175,  9175,  9175,  9175,  9175,  9175,  9175, 41288, 41288, },
+  {  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 26214,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588, 45875,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588, 45875,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588, 45875,
+     4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588,  4588, 45875, },
+  {  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, },
+  { 17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    17695,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    47186, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    47186, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486,
+    47186, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, },
+  { 15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    15729, 15729,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+    41943, 41943, 15729, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    41943, 41943, 15729, 15729, 15729, 15729, 15729, 15729, 15729, 15729,
+    41943, 41943, 15729, 15729, 15729, 15729, 15729, 15729, 15729, 15729, },
+  { 13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    13763, 13763, 13763,  7864,  7864,  7864,  7864,  7864,  7864,  7864,
+    36700, 36700, 36700, 20972, 20972, 20972, 20972, 20972, 20972, 20972,
+    36700, 36700, 36700, 20972, 20972, 20972, 20972, 20972, 20972, 20972,
+    36700, 36700, 36700, 20972, 20972, 20972, 20972, 20972, 20972, 20972, },
+  { 11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    11796, 11796, 11796, 11796,  9830,  9830,  9830,  9830,  9830,  9830,
+    31457, 31457, 31457, 31457, 26214, 26214, 26214, 26214, 26214, 26214,
+    31457, 31457, 31457, 31457, 26214, 26214, 26214, 26214, 26214, 26214,
+    31457, 31457, 31457, 31457, 26214, 26214, 26214, 26214, 26214, 26214, },
+  {  9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+     9830,  9830,  9830,  9830,  9830, 11796, 11796, 11796, 11796, 11796,
+    26214, 26214, 26214, 26214, 26214, 31457, 31457, 31457, 31457, 31457,
+    26214, 26214, 26214, 26214, 26214, 31457, 31457, 31457, 31457, 31457,
+    26214, 26214, 26214, 26214, 26214, 31457, 31457, 31457, 31457, 31457, },
+  {  7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+     7864,  7864,  7864,  7864,  7864,  7864, 13763, 13763, 13763, 13763,
+    20972, 20972, 20972, 20972, 20972, 20972, 36700, 36700, 36700, 36700,
+    20972, 20972, 20972, 20972, 20972, 20972, 36700, 36700, 36700, 36700,
+    20972, 20972, 20972, 20972, 20972, 20972, 36700, 36700, 36700, 36700, },
+  {  5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898, 15729, 15729, 15729,
+    15729, 15729, 15729, 15729, 15729, 15729, 15729, 41943, 41943, 41943,
+    15729, 15729, 15729, 15729, 15729, 15729, 15729, 41943, 41943, 41943,
+    15729, 15729, 15729, 15729, 15729, 15729, 15729, 41943, 41943, 41943, },
+  {  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932, 17695, 17695,
+    10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 47186, 47186,
+    10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 47186, 47186,
+    10486, 10486, 10486, 10486, 10486, 10486, 10486, 10486, 47186, 47186, },
+  {  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966, 19661,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 52429,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 52429,
+     5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243,  5243, 52429, },
+  {  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898, },
+  { 11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    11796,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    53084, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796,
+    53084, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796, },
+  { 10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    10486, 10486,  3932,  3932,  3932,  3932,  3932,  3932,  3932,  3932,
+    47186, 47186, 17695, 17695, 17695, 17695, 17695, 17695, 17695, 17695,
+    47186, 47186, 17695, 17695, 17695, 17695, 17695, 17695, 17695, 17695, },
+  {  9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+     9175,  9175,  9175,  5243,  5243,  5243,  5243,  5243,  5243,  5243,
+    41288, 41288, 41288, 23593, 23593, 23593, 23593, 23593, 23593, 23593,
+    41288, 41288, 41288, 23593, 23593, 23593, 23593, 23593, 23593, 23593, },
+  {  7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+     7864,  7864,  7864,  7864,  6554,  6554,  6554,  6554,  6554,  6554,
+    35389, 35389, 35389, 35389, 29491, 29491, 29491, 29491, 29491, 29491,
+    35389, 35389, 35389, 35389, 29491, 29491, 29491, 29491, 29491, 29491, },
+  {  6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+     6554,  6554,  6554,  6554,  6554,  7864,  7864,  7864,  7864,  7864,
+    29491, 29491, 29491, 29491, 29491, 35389, 35389, 35389, 35389, 35389,
+    29491, 29491, 29491, 29491, 29491, 35389, 35389, 35389, 35389, 35389, },
+  {  5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+     5243,  5243,  5243,  5243,  5243,  5243,  9175,  9175,  9175,  9175,
+    23593, 23593, 23593, 23593, 23593, 23593, 41288, 41288, 41288, 41288,
+    23593, 23593, 23593, 23593, 23593, 23593, 41288, 41288, 41288, 41288, },
+  {  3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+     3932,  3932,  3932,  3932,  3932,  3932,  3932, 10486, 10486, 10486,
+    17695, 17695, 17695, 17695, 17695, 17695, 17695, 47186, 47186, 47186,
+    17695, 17695, 17695, 17695, 17695, 17695, 17695, 47186, 47186, 47186, },
+  {  2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+     2621,  2621,  2621,  2621,  2621,  2621,  2621,  2621, 11796, 11796,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 53084, 53084,
+    11796, 11796, 11796, 11796, 11796, 11796, 11796, 11796, 53084, 53084, },
+  {  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311, 13107,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898, 58982,
+     5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898,  5898, 58982, },
+  {   655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,   655,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, },
+  {  5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+     5898,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,
+    58982, 13107, 13107, 13107, 13107, 13107, 13107, 13107, 13107, 13107, },
+  {  5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+     5243,  5243,  1966,  1966,  1966,  1966,  1966,  1966,  1966,  1966,
+    52429, 52429, 19661, 19661, 19661, 19661, 19661, 19661, 19661, 19661, },
+  {  4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+     4588,  4588,  4588,  2621,  2621,  2621,  2621,  2621,  2621,  2621,
+    45875, 45875, 45875, 26214, 26214, 26214, 26214, 26214, 26214, 26214, },
+  {  3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+     3932,  3932,  3932,  3932,  3277,  3277,  3277,  3277,  3277,  3277,
+    39322, 39322, 39322, 39322, 32768, 32768, 32768, 32768, 32768, 32768, },
+  {  3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+     3277,  3277,  3277,  3277,  3277,  3932,  3932,  3932,  3932,  3932,
+    32768, 32768, 32768, 32768, 32768, 39322, 39322, 39322, 39322, 39322, },
+  {  2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+     2621,  2621,  2621,  2621,  2621,  2621,  4588,  4588,  4588,  4588,
+    26214, 26214, 26214, 26214, 26214, 26214, 45875, 45875, 45875, 45875, },
+  {  1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+     1966,  1966,  1966,  1966,  1966,  1966,  1966,  5243,  5243,  5243,
+    19661, 19661, 19661, 19661, 19661, 19661, 19661, 52429, 52429, 52429, },
+  {  1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+     1311,  1311,  1311,  1311,  1311,  1311,  1311,  1311,  5898,  5898,
+    13107, 13107, 13107, 13107, 13107, 13107, 13107, 13107, 58982, 58982, },
+  {   655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+      655,   655,   655,   655,   655,   655,   655,   655,   655,  6554,
+     6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554, 65536, },
 };
 
-#endif //PRECOMP_TABLES_H
+#endif  // PRECOMP_TABLES_H
@@ -0,0 +1,303 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Work-stealing scheduler, see scheduler.h.
+
+#include "./scheduler.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Tasks per deque.  A worker whose deque is full runs new tasks inline.
+#define DEQUE_SIZE 4096
+#define DEQUE_MASK (DEQUE_SIZE - 1)
+
+// Failed rounds of stealing before an idle worker goes to sleep
+#define STEAL_ROUNDS_BEFORE_SLEEP 64
+
+// -----------------------------------------------------------------------------
+// Chase-Lev deque
+//
+// D. Chase and Y. Lev, "Dynamic circular work-stealing deque", SPAA 2005,
+// with the memory orderings of N. M. Le et al., "Correct and efficient
+// work-stealing for weak memory models", PPoPP 2013.  The owner pushes and
+// pops at bottom; thieves take from top.  The buffer does not grow.
+// -----------------------------------------------------------------------------
+
+typedef struct deque {
+  volatile int64_t top __attribute__((aligned(64)));
+  volatile int64_t bottom __attribute__((aligned(64)));
+  sched_task_t *tasks[DEQUE_SIZE];
+} deque_t;
+
+// Called by the owner only.  Returns false if the deque is full.
+static bool deque_push(deque_t *d, sched_task_t *task) {
+  const int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED);
+  const int64_t t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+  if (b - t >= DEQUE_SIZE) {
+    return false;
+  }
+  __atomic_store_n(&d->tasks[b & DEQUE_MASK], task, __ATOMIC_RELAXED);
+  __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELEASE);  // publish the task
+  return true;
+}
+
+// Called by the owner only.  Returns NULL if the deque is empty.
+static sched_task_t *deque_pop(deque_t *d) {
+  const int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED) - 1;
+  __atomic_store_n(&d->bottom, b, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  int64_t t = __atomic_load_n(&d->top, __ATOMIC_RELAXED);
+
+  if (t > b) {  // empty
+    __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+    return NULL;
+  }
+  sched_task_t *task = __atomic_load_n(&d->tasks[b & DEQUE_MASK], __ATOMIC_RELAXED);
+  if (t == b) {
+    // Last task: race the thieves for it
+    if (!__atomic_compare_exchange_n(&d->top, &t, t + 1, false,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+      task = NULL;
+    }
+    __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+  }
+  return task;
+}
+
+// Called by any worker but the owner.  Returns NULL if the deque is empty or
+// another worker got the task first.
+static sched_task_t *deque_steal(deque_t *d) {
+  int64_t t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  const int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+  if (t >= b) {
+    return NULL;
+  }
+  sched_task_t *task = __atomic_load_n(&d->tasks[t & DEQUE_MASK], __ATOMIC_RELAXED);
+  if (!__atomic_compare_exchange_n(&d->top, &t, t + 1, false,
+                                   __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+    return NULL;
+  }
+  return task;
+}
+
+static bool deque_is_empty(deque_t *d) {
+  return __atomic_load_n(&d->top, __ATOMIC_ACQUIRE) >=
+      __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+}
+
+// -----------------------------------------------------------------------------
+// Workers
+// -----------------------------------------------------------------------------
+
+static deque_t deques[MAX_WORKERS];
+static pthread_t threads[MAX_WORKERS];
+static int num_workers = 1;
+static volatile bool stopping = false;
+
+// Idle workers sleep on sleep_cond; sched_spawn wakes one if any are asleep.
+static pthread_mutex_t sleep_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sleep_cond = PTHREAD_COND_INITIALIZER;
+static volatile int num_sleeping = 0;
+
+static __thread int worker_id = 0;
+static __thread uint32_t steal_seed = 0;
+
+int sched_num_workers() {
+  return num_workers;
+}
+
+int sched_worker_id() {
+  return worker_id;
+}
+
+static void run_task(sched_task_t *task) {
+  sched_group_t *group = task->group;
+  task->fn(task);
+  // task and group may be gone as soon as pending drops
+  __atomic_sub_fetch(&group->pending, 1, __ATOMIC_RELEASE);
+}
+
+// Tries every other worker once, starting at a random one.
+static sched_task_t *steal_any() {
+  steal_seed = steal_seed * 1664525 + 1013904223;
+  const int start = (steal_seed >> 16) % num_workers;
+  for (int k = 0; k < num_workers; k++) {
+    const int victim = (start + k) % num_workers;
+    if (victim == worker_id) {
+      continue;
+    }
+    sched_task_t *task = deque_steal(&deques[victim]);
+    if (task != NULL) {
+      return task;
+    }
+  }
+  return NULL;
+}
+
+static bool work_available() {
+  for (int i = 0; i < num_workers; i++) {
+    if (!deque_is_empty(&deques[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void sleep_until_work() {
+  pthread_mutex_lock(&sleep_mutex);
+  __atomic_add_fetch(&num_sleeping, 1, __ATOMIC_SEQ_CST);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  while (!stopping && !work_available()) {
+    pthread_cond_wait(&sleep_cond, &sleep_mutex);
+  }
+  __atomic_sub_fetch(&num_sleeping, 1, __ATOMIC_SEQ_CST);
+  pthread_mutex_unlock(&sleep_mutex);
+}
+
+static void wake_one() {
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&num_sleeping, __ATOMIC_SEQ_CST) > 0) {
+    pthread_mutex_lock(&sleep_mutex);
+    pthread_cond_signal(&sleep_cond);
+    pthread_mutex_unlock(&sleep_mutex);
+  }
+}
+
+static void *worker_main(void *arg) {
+  worker_id = (int) (intptr_t) arg;
+  steal_seed = worker_id;
+  int failed_rounds = 0;
+  while (!__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+    sched_task_t *task = steal_any();
+    if (task != NULL) {
+      run_task(task);
+      failed_rounds = 0;
+    } else if (++failed_rounds < STEAL_ROUNDS_BEFORE_SLEEP) {
+      sched_yield();
+    } else {
+      sleep_until_work();
+      failed_rounds = 0;
+    }
+  }
+  return NULL;
+}
+
+void sched_set_workers(int n) {
+  if (n < 1) {
+    n = 1;
+  }
+  if (n > MAX_WORKERS) {
+    n = MAX_WORKERS;
+  }
+  if (n == num_workers) {
+    return;
+  }
+
+  // Stop the old workers
+  pthread_mutex_lock(&sleep_mutex);
+  __atomic_store_n(&stopping, true, __ATOMIC_RELEASE);
+  pthread_cond_broadcast(&sleep_cond);
+  pthread_mutex_unlock(&sleep_mutex);
+  for (int i = 1; i < num_workers; i++) {
+    pthread_join(threads[i], NULL);
+  }
+
+  num_workers = n;
+  for (int i = 0; i < num_workers; i++) {
+    deques[i].top = 0;
+    deques[i].bottom = 0;
+  }
+  __atomic_store_n(&stopping, false, __ATOMIC_RELEASE);
+  for (int i = 1; i < num_workers; i++) {
+    if (pthread_create(&threads[i], NULL, worker_main, (void *) (intptr_t) i) != 0) {
+      fprintf(stderr, "sched_set_workers: could not start worker %d\n", i);
+      exit(1);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Fork/join
+// -----------------------------------------------------------------------------
+
+void sched_init_group(sched_group_t *group) {
+  group->pending = 0;
+}
+
+void sched_spawn(sched_group_t *group, sched_task_t *task, sched_task_fn_t fn) {
+  task->fn = fn;
+  task->group = group;
+  __atomic_add_fetch(&group->pending, 1, __ATOMIC_RELAXED);
+  if (num_workers == 1 || !deque_push(&deques[worker_id], task)) {
+    run_task(task);
+    return;
+  }
+  wake_one();
+}
+
+void sched_sync(sched_group_t *group) {
+  while (__atomic_load_n(&group->pending, __ATOMIC_ACQUIRE) > 0) {
+    // Our own tasks first, then anybody's
+    sched_task_t *task = deque_pop(&deques[worker_id]);
+    if (task == NULL) {
+      task = steal_any();
+    }
+    if (task != NULL) {
+      run_task(task);
+    } else {
+      sched_yield();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Parallel loop
+//
+// The range is split in halves recursively, as cilk_for does, so a thief
+// takes half of the remaining iterations at a time.
+// -----------------------------------------------------------------------------
+
+typedef struct loop_task {
+  sched_task_t task;  // must be first
+  int begin;
+  int end;
+  sched_loop_body_t body;
+  void *arg;
+} loop_task_t;
+
+static void loop_range(int begin, int end, sched_loop_body_t body, void *arg);
+
+static void loop_task_fn(sched_task_t *task) {
+  loop_task_t *t = (loop_task_t *) task;
+  loop_range(t->begin, t->end, t->body, t->arg);
+}
+
+static void loop_range(int begin, int end, sched_loop_body_t body, void *arg) {
+  if (end - begin == 1) {
+    body(arg, begin);
+    return;
+  }
+  const int mid = begin + (end - begin) / 2;
+  loop_task_t right = { .begin = mid, .end = end, .body = body, .arg = arg };
+  sched_group_t group;
+  sched_init_group(&group);
+  sched_spawn(&group, &right.task, loop_task_fn);
+  loop_range(begin, mid, body, arg);
+  sched_sync(&group);
+}
+
+void sched_parallel_for(int begin, int end, sched_loop_body_t body, void *arg) {
+  if (num_workers == 1) {
+    for (int i = begin; i < end; i++) {
+      body(arg, i);
+    }
+    return;
+  }
+  if (begin < end) {
+    loop_range(begin, end, body, arg);
+  }
+}
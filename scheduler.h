@@ -0,0 +1,56 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// A small work-stealing scheduler for the parallel parts of the search.
+//
+// Each worker owns a Chase-Lev deque of tasks.  A worker pushes and pops
+// tasks at the bottom of its own deque, and idle workers steal from the top
+// of other workers' deques.  Workers 1 and up are started by the scheduler.
+// Any other thread (the input loop, the search thread) is worker 0, so only
+// one of them may use the scheduler at a time.
+//
+// The fork/join API is a task group: tasks spawned into a group are run by
+// any worker, and sched_sync() returns once all of them have finished.  While
+// waiting, the syncing worker runs tasks itself, so it never blocks with work
+// left in the system.  sched_parallel_for() is built on top of this.
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdbool.h>
+
+#define MAX_WORKERS 64
+
+typedef struct sched_task sched_task_t;
+typedef struct sched_group sched_group_t;
+
+typedef void (*sched_task_fn_t)(sched_task_t *task);
+
+struct sched_group {
+  volatile int pending;  // tasks spawned into the group that have not finished
+};
+
+// A task is embedded in (or is) the caller's argument record; fn finds its
+// arguments from the task pointer.  The task and its arguments must stay
+// alive until the group is synced.
+struct sched_task {
+  sched_task_fn_t fn;
+  sched_group_t *group;
+};
+
+// Starts or stops workers so that there are n of them, n >= 1.  Must not be
+// called while tasks are running.
+void sched_set_workers(int n);
+int sched_num_workers();
+
+// Id of the calling worker, 0 .. sched_num_workers() - 1.
+int sched_worker_id();
+
+void sched_init_group(sched_group_t *group);
+void sched_spawn(sched_group_t *group, sched_task_t *task, sched_task_fn_t fn);
+void sched_sync(sched_group_t *group);
+
+// Calls body(arg, i) for begin <= i < end, in parallel.
+typedef void (*sched_loop_body_t)(void *arg, int i);
+void sched_parallel_for(int begin, int end, sched_loop_body_t body, void *arg);
+
+#endif  // SCHEDULER_H
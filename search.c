@@ -15,6 +15,7 @@ implementation has been provided for you.
 
 #include "./search.h"
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -22,8 +23,6 @@ implementation has been provided for you.
 #include <stdbool.h>
 #include <string.h>
 #include <pthread.h>
-#include <cilk/cilk.h>
-#include <cilk/reducer.h>
 
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
@@ -32,15 +31,10 @@ implementation has been provided for you.
 #include "./tt.h"
 #include "./util.h"
 #include "./fen.h"
+#include "./scheduler.h"
 #include "./tbassert.h"
 
 
-// -----------------------------------------------------------------------------
-// Preprocessor
-// -----------------------------------------------------------------------------
-
-#define ABORT_CHECK_PERIOD 0xfff
-
 // -----------------------------------------------------------------------------
 // READ ONLY settings (see iopt in leiserchess.c)
 // -----------------------------------------------------------------------------
@@ -58,16 +52,18 @@ int LMR_R2;    // After this number of moves reduce 2 ply
 int USE_NMM;
 int TRACE_MOVES;   // Print moves
 int DETECT_DRAWS;  // Detect draws by repetition
+int THREADS;       // Number of search workers, see scheduler.h
+int LAZY_SMP;      // Search with Lazy SMP instead of in parallel scout nodes
+int MERGE_HISTORY; // Merge the workers' history tables between iterations
+int WORKER_STATS;  // Print every worker's node counts after a search
 
 // do not set more than 5 ply
 int FUT_DEPTH;     // set to zero for no futilty
 
 
 // Declare the two main search functions.
-static score_t searchPV(searchNode *node, int depth,
-                        uint64_t *node_count_serial);
-static score_t scout_search(searchNode *node, int depth,
-                            uint64_t *node_count_serial);
+static score_t searchPV(searchNode *node, int depth);
+static score_t scout_search(searchNode *node, int depth);
 void assert_sorted(sortable_move_t * move_list,int num_of_moves);
 // Include common search functions
 #include "./search_globals.c"
@@ -81,22 +77,158 @@ static void initialize_pv_node(searchNode* node, int depth) {
   node->alpha = -node->parent->beta;
   node->orig_alpha = node->alpha;  // Save original alpha.
   node->beta = -node->parent->alpha;
-  node->subpv[0] = 0;
+  node->best_move = 0;
   node->depth = depth;
   node->legal_move_count = 0;
   node->ply = node->parent->ply + 1;
-  node->fake_color_to_move = color_to_move_of(&(node->position));
+  pv_clear(node->ply);
+  node->fake_color_to_move = color_to_move_of(node->position);
   // point of view = 1 for white, -1 for black
   node->pov = 1 - node->fake_color_to_move * 2;
   node->quiescence = (depth <= 0);
   node->best_move_index = 0;
   node->best_score = -INF;
   node->abort = false;
+  node->abort_cell = node->parent->child_cell;
+  node->child_cell = node->abort_cell;
+  node->defer_research = false;
+}
+
+// PV nodes and the root search their first move serially and the rest of
+// their moves in parallel, unless there is nobody to share the work with.
+static bool split_pv_nodes() {
+  return !LAZY_SMP && sched_num_workers() > 1;
+}
+
+// -----------------------------------------------------------------------------
+// PV splitting
+//
+// After the first move of a PV node, the other moves are searched with null
+// windows around alpha, in parallel.  Moves that fail low are final.  Moves
+// that fail high are re-searched with the full window afterwards, one at a
+// time and in order, as the serial search would do.  Since nothing raises
+// alpha while the null-window searches run, they all use the same window.
+// -----------------------------------------------------------------------------
+
+// State shared by the parallel iterations of a PV node's move loop
+typedef struct pvSplit {
+  searchNode *node;
+  const sortable_move_t *move_list;
+  bool *fail_high;  // moves that must be searched again, by index
+  simple_mutex_t *node_mutex;
+  move_t killer_a;
+  move_t killer_b;
+} pvSplit;
+
+static void pv_split_move(void *arg, int mv_index) {
+  pvSplit *split = (pvSplit *) arg;
+  searchNode *node = split->node;
+  move_t mv = get_move(split->move_list[mv_index]);
+
+  if (TRACE_MOVES) {
+    print_move_info(mv, node->ply);
+  }
+
+  use_search_tables();
+  count_node();
+
+  position_t position = *node->position;
+
+  moveEvaluationResult result;
+  result.next_node.parent = node;
+  result.next_node.position = &position;
+
+  // With defer_research set, this is only the null-window search
+  evaluateMove(node, mv, split->killer_a, split->killer_b,
+               SEARCH_PV,
+               &result);
+
+  if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE || abortf) {
+    return;
+  }
+  if (result.type == MOVE_EVALUATED) {
+    __sync_fetch_and_add(&node->legal_move_count, 1);
+  }
+  if (result.score > node->alpha) {
+    split->fail_high[mv_index] = true;
+    return;
+  }
+
+  // Cannot cut off or raise alpha, since score <= alpha.  The PV table
+  // belongs to the thread searching node, so the PV is set after the loop.
+  simple_acquire(split->node_mutex);
+  if (result.score > node->best_score) {
+    node->best_score = result.score;
+    node->best_move_index = mv_index;
+    node->best_move = mv;
+  }
+  simple_release(split->node_mutex);
+}
+
+// Searches the moves of node that picker has not handed out yet.  Returns
+// false if the search was aborted.
+static bool searchPV_split(searchNode *node, movePicker *picker,
+                           move_t killer_a, move_t killer_b) {
+  pick_all_remaining(picker);
+  const int first = picker->num_picked;
+
+  bool fail_high[MAX_NUM_MOVES] = { false };
+  simple_mutex_t node_mutex;
+  init_simple_mutex(&node_mutex);
+
+  pvSplit split = {
+    .node = node,
+    .move_list = picker->move_list,
+    .fail_high = fail_high,
+    .node_mutex = &node_mutex,
+    .killer_a = killer_a,
+    .killer_b = killer_b
+  };
+  node->defer_research = true;
+  sched_parallel_for(first, picker->num_moves, pv_split_move, &split);
+  node->defer_research = false;
+  picker->num_picked = picker->num_moves;
+
+  if (abortf) {
+    return false;
+  }
+  if (node->best_move_index >= first) {
+    pv_clear(node->ply + 1);
+    pv_update(node->ply, node->best_move);
+  }
+
+  moveEvaluationResult result;
+  result.next_node.parent = node;
+  result.next_node.position = node->position;
+
+  for (int mv_index = first; mv_index < picker->num_moves; mv_index++) {
+    if (!fail_high[mv_index]) {
+      continue;
+    }
+    move_t mv = get_move(picker->move_list[mv_index]);
+    // Searched with a null window again first, in case alpha has moved up
+    pv_clear(node->ply + 1);
+    evaluateMove(node, mv, killer_a, killer_b,
+                 SEARCH_PV,
+                 &result);
+    if (abortf) {
+      return false;
+    }
+    if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE) {
+      continue;
+    }
+    if (search_process_score(node, mv, mv_index, &result, SEARCH_PV)) {
+      break;
+    }
+  }
+  return true;
 }
 
 // Perform a Principle Variation Search
 //   https://chessprogramming.wikispaces.com/Principal+Variation+Search
-static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial) {
+static score_t searchPV(searchNode *node, int depth) {
+  use_search_tables();
+
   // Initialize the searchNode data structure.
   initialize_pv_node(node, depth);
 
@@ -121,44 +253,33 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
   move_t killer_b = killer[KMT(node->ply, 1)];
 
 
-  // sortable_move_t move_list
-  //
-  // Contains a list of possible moves at this node. These moves are "sortable"
-  //   and can be compared as integers. This is accomplished by using high-order
-  //   bits to store a sort key.
-  //
-  // Keep track of the number of moves that we have considered at this node.
-  //   After we finish searching moves at this node the move_list array will
-  //   be organized in the following way:
+  // Moves come from a staged picker (see search_common.c), which keeps the
+  //   moves it has handed out at the front of its move_list:
   //
   //   m0, m1, ... , m_k-1, m_k, ... , m_N-1
   //
-  //  where k = num_moves_tried, and N = num_of_moves
+  //  where k = picker.num_picked, the number of moves tried so far.
   //
   //  This will allow us to update the best_move_history table easily by
   //  scanning move_list from index 0 to k such that we update the table
   //  only for moves that we actually considered at this node.
-  sortable_move_t move_list[MAX_NUM_MOVES];
-  int num_of_moves = get_sortable_move_list(node, move_list, hash_table_move);
-  int num_moves_tried = 0;
+  movePicker picker;
+  init_move_picker(&picker, node, hash_table_move);
 
   moveEvaluationResult result;
-  result.next_node.subpv[0] = 0;
   result.next_node.parent = node;
+  result.next_node.position = node->position;  // moves are made in place
 
   // Start searching moves.
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
-    // Incrementally sort the move list.
-    sort_incremental_new(move_list, num_of_moves, mv_index);
-
-    move_t mv = get_move(move_list[mv_index]);
+  move_t mv;
+  while ((mv = next_move(&picker)) != 0) {
+    int mv_index = picker.num_picked - 1;
 
-    num_moves_tried++;
-    (*node_count_serial)++;
+    count_node();
 
+    pv_clear(node->ply + 1);
     evaluateMove(node, mv, killer_a, killer_b,
                  SEARCH_PV,
-                 node_count_serial,
                  &result);
 
     if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE) {
@@ -180,11 +301,18 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
     if (cutoff) {
       break;
     }
+
+    if (node->legal_move_count > 0 && !node->quiescence && split_pv_nodes()) {
+      if (!searchPV_split(node, &picker, killer_a, killer_b)) {
+        return 0;
+      }
+      break;
+    }
   }
 
   if (node->quiescence == false) {
-    update_best_move_history(&(node->position), node->best_move_index,
-                             move_list, num_moves_tried);
+    update_best_move_history(node->position, node->best_move_index,
+                             picker.move_list, picker.num_picked);
   }
 
   tbassert(abs(node->best_score) != -INF, "best_score = %d\n",
@@ -193,8 +321,8 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
   // Update the transposition table.
   //
   // Note: This function reads node->best_score, node->orig_alpha,
-  //   node->position.key, node->depth, node->ply, node->beta,
-  //   node->alpha, node->subpv
+  //   node->position->key, node->depth, node->ply, node->beta,
+  //   node->alpha, node->best_move
   update_transposition_table(node);
 
   return node->best_score;
@@ -206,29 +334,76 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
 // This handles scout search logic for the first level of the search tree
 // -----------------------------------------------------------------------------
 static void initialize_root_node(searchNode *node, score_t alpha, score_t beta, int depth,
-                            int ply, position_t* p) {
+                            int ply, position_t* p, abortCell *root_cell) {
   node->type = SEARCH_ROOT;
   node->alpha = alpha;
   node->beta = beta;
   node->depth = depth;
   node->ply = ply;
-  node->position = *p;
-  node->fake_color_to_move = color_to_move_of(&(node->position));
+  node->position = p;
+  node->fake_color_to_move = color_to_move_of(node->position);
   node->best_score = -INF;
   node->pov = 1 - node->fake_color_to_move * 2;  // pov = 1 for White, -1 for Black
   node->abort = false;
+  node->abort_cell = root_cell;
+  node->child_cell = root_cell;
+}
+
+// State shared by the parallel iterations of the root's move loop
+typedef struct rootSplit {
+  searchNode *root;
+  const sortable_move_t *move_list;
+  bool *fail_high;  // moves that must be searched again, by index
+} rootSplit;
+
+// The root's version of pv_split_move.  Game-ending and repeated positions
+// are left to the serial loop, which scores them anyway.
+static void root_split_move(void *arg, int mv_index) {
+  rootSplit *split = (rootSplit *) arg;
+  searchNode *root = split->root;
+  move_t mv = get_move(split->move_list[mv_index]);
+
+  if (TRACE_MOVES) {
+    print_move_info(mv, root->ply);
+  }
+
+  use_search_tables();
+  count_node();
+
+  position_t position = *root->position;
+  undo_t undo;
+  victims_t x = do_move(&position, mv, &undo);
+  if (is_KO(x)) {
+    return;  // not a legal move
+  }
+  if (is_game_over(x, root->pov, root->ply) || is_repeated(&position, root->ply)) {
+    split->fail_high[mv_index] = true;
+    return;
+  }
+
+  searchNode next_node;
+  next_node.parent = root;
+  next_node.position = &position;
+  score_t score = -scout_search(&next_node, root->depth - 1);
+  if (score > root->alpha && !abortf) {
+    split->fail_high[mv_index] = true;
+  }
 }
 
 score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
-                   int ply, move_t *pv, uint64_t *node_count_serial,
-                   FILE *OUT) {
-  static int num_of_moves = 0;  // number of moves in list
+                   int ply, move_t *pv, FILE *OUT) {
+  // Each search thread (see lazy_smp_start) orders its own root moves.
+  static __thread int num_of_moves = 0;  // number of moves in list
   // hopefully, more than we will need
-  static sortable_move_t move_list[MAX_NUM_MOVES];
+  static __thread sortable_move_t move_list[MAX_NUM_MOVES];
+
+  use_search_tables();
+
+  pv[0] = 0;  // until a move is scored
 
   if (depth == 1) {
     // we are at depth 1; generate all possible moves
-    num_of_moves = generate_all(p, move_list, false);
+    num_of_moves = generate_all(p, move_list, false, NULL);
     // shuffle the list of moves
     for (int i = 0; i < num_of_moves; i++) {
       int r = myrand() % num_of_moves;
@@ -238,67 +413,98 @@ score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
     }
   }
 
+  // Moves are made in place on a copy, so that an abort anywhere in the
+  // tree leaves the caller's position untouched.
+  position_t root_position = *p;
+
+  // The root never aborts; this is the top of the tree of abortCells
+  abortCell root_cell = { .aborted = false };
+
   searchNode rootNode;
   rootNode.parent = NULL;
-  initialize_root_node(&rootNode, alpha, beta, depth, ply, p);
+  initialize_root_node(&rootNode, alpha, beta, depth, ply, &root_position,
+                       &root_cell);
 
   assert(rootNode.best_score == alpha);  // initial conditions
 
   searchNode next_node;
-  next_node.subpv[0] = 0;
   next_node.parent = &rootNode;
+  next_node.position = &root_position;
 
   score_t score;
 
+  if (depth > 1 && MERGE_HISTORY && split_pv_nodes()) {
+    merge_best_move_history();
+  }
+
+  // With PV splitting, only the moves that fail high in the parallel
+  // null-window searches go through the loop after the first one.
+  bool split = false;
+  bool fail_high[MAX_NUM_MOVES] = { false };
+
   for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
+    if (mv_index == 1 && rootNode.depth > 1 && split_pv_nodes()) {
+      rootSplit root_split = {
+        .root = &rootNode,
+        .move_list = move_list,
+        .fail_high = fail_high
+      };
+      sched_parallel_for(1, num_of_moves, root_split_move, &root_split);
+      if (abortf) {
+        return 0;
+      }
+      split = true;
+    }
+    if (split && !fail_high[mv_index]) {
+      continue;
+    }
+
     move_t mv = get_move(move_list[mv_index]);
 
-    if (TRACE_MOVES) {
+    if (TRACE_MOVES && OUT != NULL) {
       print_move_info(mv, ply);
     }
 
-    (*node_count_serial)++;
+    if (!split) {
+      count_node();  // else counted by root_split_move
+    }
+    pv_clear(rootNode.ply + 1);
     // make the move.
-    victims_t x = make_move(&(rootNode.position), &(next_node.position), mv);
+    undo_t undo;
+    victims_t x = do_move(&root_position, mv, &undo);
     if (is_KO(x)) {
+      undo_move(&root_position, &undo);
       continue;  // not a legal move
     }
 
     if (is_game_over(x, rootNode.pov, rootNode.ply)) {
       score = get_game_over_score(x, rootNode.pov, rootNode.ply);
-      next_node.subpv[0] = 0;
+      undo_move(&root_position, &undo);
       goto scored;
     }
 
-    if (is_repeated(&(next_node.position), rootNode.ply)) {
-      score = get_draw_score(&(next_node.position), rootNode.ply);
-      next_node.subpv[0] = 0;
+    if (is_repeated(&root_position, rootNode.ply)) {
+      score = get_draw_score(&root_position, rootNode.ply);
+      undo_move(&root_position, &undo);
       goto scored;
     }
 
     if (mv_index == 0 || rootNode.depth == 1) {
       // We guess that the first move is the principle variation
-      score = -searchPV(&next_node, rootNode.depth-1, node_count_serial);
-      // Check if we should abort due to time control.
-      if (abortf) {
-        return 0;
-      }
+      score = -searchPV(&next_node, rootNode.depth-1);
     } else {
-      score = -scout_search(&next_node, rootNode.depth-1, node_count_serial);
-      // Check if we should abort due to time control.
-      if (abortf) {
-        return 0;
-      }
+      score = -scout_search(&next_node, rootNode.depth-1);
 
       // If its score exceeds the current best score,
-      if (score > rootNode.alpha) {
-        score = -searchPV(&next_node, rootNode.depth-1, node_count_serial);
-        // Check if we should abort due to time control.
-        if (abortf) {
-          return 0;
-        }
+      if (score > rootNode.alpha && !abortf) {
+        score = -searchPV(&next_node, rootNode.depth-1);
       }
+    }
+    undo_move(&root_position, &undo);
 
+    // Check if we should abort due to time control.
+    if (abortf) {
+      return 0;
     }
 
   scored:
@@ -312,22 +518,29 @@ score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
 
       rootNode.best_score = score;
       pv[0] = mv;
-      memcpy(pv+1, next_node.subpv, sizeof(move_t) * (MAX_PLY_IN_SEARCH - 1));
-      pv[MAX_PLY_IN_SEARCH - 1] = 0;
+      int pv_len = 1;
+      for (int i = rootNode.ply + 1; i < pv_length[rootNode.ply + 1]; i++) {
+        pv[pv_len++] = pv_table[rootNode.ply + 1][i];
+      }
+      pv[pv_len] = 0;
 
       // Print out based on UCI (universal chess interface)
-      double et = elapsed_time();
-      char   pvbuf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
-      getPV(pv, pvbuf, MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE);
-      if (et < 0.00001) {
-        et = 0.00001;  // hack so that we don't divide by 0
-      }
+      if (OUT != NULL) {
+        double et = elapsed_time();
+        char   pvbuf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
+        getPV(pv, pvbuf, MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE);
+        if (et < 0.00001) {
+          et = 0.00001;  // hack so that we don't divide by 0
+        }
 
-      uint64_t nps = 1000 * *node_count_serial / et;
-      fprintf(OUT, "info depth %d move_no %d time (microsec) %d nodes %" PRIu64
-              " nps %" PRIu64 "\n",
-              depth, mv_index + 1, (int) (et * 1000), *node_count_serial, nps);
-      fprintf(OUT, "info score cp %d pv %s\n", score, pvbuf);
+        // Counted by every worker, see search_globals.c
+        uint64_t nodes = search_node_count();
+        uint64_t nps = 1000 * nodes / et;
+        fprintf(OUT, "info depth %d move_no %d time (microsec) %d nodes %" PRIu64
+                " nps %" PRIu64 "\n",
+                depth, mv_index + 1, (int) (et * 1000), nodes, nps);
+        fprintf(OUT, "info score cp %d pv %s\n", score, pvbuf);
+      }
 
       // Slide this move to the front of the move list
       for (int j = mv_index; j > 0; j--) {
@@ -351,6 +564,90 @@ score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
   return rootNode.best_score;
 }
 
+// -----------------------------------------------------------------------------
+// Lazy SMP
+//
+// With LAZY_SMP set, the search is not split inside scout nodes.  Instead,
+// while the calling thread runs its usual iterative deepening, THREADS - 1
+// helpers run iterative deepening of their own on the same root, as tasks on
+// the scheduler's workers.  Each helper has its worker's killer and history
+// tables to itself and shuffles its root moves with its own seed, and each
+// helper skips a different pattern of depths (see lazy_skip_depth), so that
+// the helpers spread over different parts of the tree.  They only communicate
+// through the transposition table; their results are never reported.
+//   https://chessprogramming.wikispaces.com/Lazy+SMP
+// -----------------------------------------------------------------------------
+
+typedef struct lazyHelper {
+  sched_task_t task;  // must be first
+  int id;
+  position_t *position;
+  int depth;
+} lazyHelper;
+
+static lazyHelper lazy_helpers[MAX_WORKERS];
+static int num_lazy_helpers = 0;
+static sched_group_t lazy_group;
+static volatile bool lazy_stop = false;
+
+// Helper id cycles through these: helper i skips depth d if
+// (d + phase) / size is odd, with size and phase the entries for (i - 1) % 20.
+// Size 1 skips every other depth, starting at an even or an odd one; larger
+// sizes skip runs of depths at different offsets.
+#define LAZY_SKIP_PATTERNS 20
+static const int lazy_skip_size[LAZY_SKIP_PATTERNS] =
+    { 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+static const int lazy_skip_phase[LAZY_SKIP_PATTERNS] =
+    { 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7 };
+
+static bool lazy_skip_depth(int id, int depth) {
+  const int i = (id - 1) % LAZY_SKIP_PATTERNS;
+  return ((depth + lazy_skip_phase[i]) / lazy_skip_size[i]) % 2 != 0;
+}
+
+static void lazy_helper_search(sched_task_t *task) {
+  lazyHelper *h = (lazyHelper *) task;
+  move_t pv[MAX_PLY_IN_SEARCH];
+
+  // Otherwise every helper would order its root moves as the main thread does
+  myrand_seed(h->id);
+
+  // Depth 1 orders this thread's root moves, see searchRoot.
+  for (int d = 1; d <= h->depth && !lazy_stop; d++) {
+    if (d > 1 && lazy_skip_depth(h->id, d)) {
+      continue;
+    }
+    searchRoot(h->position, -INF, INF, d, 0, pv, NULL);
+  }
+}
+
+void lazy_smp_start(position_t *p, int depth) {
+  tbassert(num_lazy_helpers == 0, "Lazy SMP search already running\n");
+  lazy_stop = false;
+  num_lazy_helpers = sched_num_workers() - 1;
+  sched_init_group(&lazy_group);
+  for (int i = 0; i < num_lazy_helpers; i++) {
+    lazyHelper *h = &lazy_helpers[i];
+    h->id = i + 1;
+    h->position = p;
+    h->depth = depth < MAX_PLY_IN_SEARCH - 1 ? depth : MAX_PLY_IN_SEARCH - 1;
+    sched_spawn(&lazy_group, &h->task, lazy_helper_search);
+  }
+}
+
+uint64_t lazy_smp_finish() {
+  lazy_stop = true;
+  abortf = true;  // stops the helpers' current iterations
+  sched_sync(&lazy_group);
+  num_lazy_helpers = 0;
+
+  // The calling thread is worker 0; the helpers ran on the others.
+  uint64_t own_nodes, qnodes, tt_hits;
+  if (!search_worker_stats(0, &own_nodes, &qnodes, &tt_hits)) {
+    own_nodes = 0;
+  }
+  return search_node_count() - own_nodes;
+}
 
 void assert_sorted(sortable_move_t * move_list, int num_of_moves) {
   for(int i = 0; i < num_of_moves; i++){
@@ -43,6 +43,19 @@ typedef enum searchType {  // different types of search
   SEARCH_SCOUT
 } searchType_t;
 
+// Abort flag shared by the nodes below a scout node that searches its moves
+// in parallel.  When that node gets a cutoff it aborts its cell, and with it
+// the cells of all parallel nodes below it that are still running, so that
+// every node can check whether an ancestor aborted in constant time.
+typedef struct abortCell {
+  volatile bool aborted;
+  int lock;  // simple_mutex_t, guards aborted and the list of children
+  struct abortCell *parent;
+  struct abortCell *first_child;  // cells of the running parallel nodes below
+  struct abortCell *prev_sibling;
+  struct abortCell *next_sibling;
+} abortCell;
+
 typedef struct searchNode {
   struct searchNode* parent;
   searchType_t type;
@@ -56,23 +69,50 @@ typedef struct searchNode {
   int pov;
   int legal_move_count;
   bool abort;
+  abortCell *abort_cell;  // of the nearest parallel ancestor, never NULL
+  abortCell *child_cell;  // for the children: own cell if parallel, else abort_cell
+  bool defer_research;  // PV node searching moves in parallel, see searchPV
   score_t best_score;
   int best_move_index;
-  position_t position;
-  move_t subpv[MAX_PLY_IN_SEARCH];
+  position_t *position;  // shared with the parent; see evaluateMove
+  laser_info_t laser_info;  // of position, set by evaluate_as_leaf
+  move_t best_move;  // the PV of a PV node is in the PV table, see search_globals.c
 } searchNode;
 
 
-void init_tics();
-void init_abort_timer(double goal_time);
+// Aborts the search max_time ms from now.
+void init_abort_timer(double max_time);
+// Whether the timer aborted the search; if so, sets ms_late to the time
+// since the timeout.
+bool abort_timer_fired(double *ms_late);
 double elapsed_time();
 bool should_abort();
 void reset_abort();
+void init_stop();
+void stop_search();
 void init_best_move_history();
+void clear_killers();
+// Beta cutoffs in the current search, over all workers, and how many of
+// them were caused by the first move tried.
+void search_cutoff_stats(uint64_t *cutoffs, uint64_t *first_move_cutoffs);
+// Moves tried in the current search, over all workers.
+uint64_t search_node_count();
+// Stops searches once they have tried this many moves; 0 for no limit.
+void set_node_limit(uint64_t nodes);
+// Moves tried, quiescence nodes and transposition table hits of one worker
+// in the current search.  Returns false if the worker has not searched.
+// Not for use while searching.
+bool search_worker_stats(int worker, uint64_t *nodes, uint64_t *qnodes,
+                         uint64_t *tt_hits);
 move_t get_move(sortable_move_t sortable_mv);
+// pv[0] is left 0 if the search is aborted before it scores a move.
 score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
-                   int ply, move_t *pv, uint64_t *node_count_serial,
-                   FILE *OUT);
+                   int ply, move_t *pv, FILE *OUT);
+
+// Lazy SMP: start helper searches of p up to depth on the scheduler's other
+// workers, and stop them again, returning the number of nodes they searched.
+void lazy_smp_start(position_t *p, int depth);
+uint64_t lazy_smp_finish();
 
 
 #endif  // SEARCH_H
@@ -1,7 +1,9 @@
 // Copyright (c) 2015 MIT License by 6.172 Staff
 
 
+#include <pthread.h>
 #include <stdlib.h>
+#include <time.h>
 
 void sort_incremental_new(sortable_move_t *move_list, int num_of_moves, int mv_index);
 
@@ -9,11 +11,13 @@ void qsort( void *buf, size_t num, size_t size, int (*compare)(const void *, con
 
 int compare(const void * a, const void * b);
 
-// tic counter for how often we should check for abort
-static int     tics = 0;
 static double  sstart;    // start time of a search in milliseconds
-static double  timeout;   // time elapsed before abort
-static bool    abortf = false;  // abort flag for search
+static double  timeout;   // time elapsed before abort, see the abort timer
+// Abort flag for search, all threads.  Every node reads it, so it has a
+// cache line to itself, written about once per iteration.
+static volatile bool abortf __attribute__((aligned(64))) = false;
+// The search must end: stop_search was called, or the timeout passed
+static volatile bool stopf __attribute__((aligned(64))) = false;
 
 static score_t fmarg[10] = {
   0, PAWN_VALUE / 2, PAWN_VALUE, (PAWN_VALUE * 5) / 2, (PAWN_VALUE * 9) / 2,
@@ -60,10 +64,112 @@ static void set_sort_key(sortable_move_t *mv, sort_key_t key) {
   return;
 }
 
-void init_abort_timer(double goal_time) {
+// -----------------------------------------------------------------------------
+// Abort timer
+//
+// A timer thread sleeps until the timeout and then aborts the search, so
+// that nodes never read the clock.
+// -----------------------------------------------------------------------------
+
+// Longest single wait, so that the absolute time cannot overflow
+#define MAX_TIMER_WAIT_MS (3600 * 1000.0)
+
+static pthread_mutex_t timer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t timer_cond;  // signaled when timeout changes
+static bool timer_started = false;
+static double timer_fired_at = 0.0;  // time the timer aborted the search, or 0
+
+// The time ms from now, as pthread_cond_timedwait on timer_cond takes it
+static struct timespec timer_abstime(double ms) {
+  struct timespec ts;
+#if MACPORT
+  clock_gettime(CLOCK_REALTIME, &ts);
+#else
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+  const int64_t ns = ts.tv_nsec + (int64_t) (ms * 1000000.0);
+  ts.tv_sec += ns / 1000000000;
+  ts.tv_nsec = ns % 1000000000;
+  return ts;
+}
+
+static void *abort_timer_main(void *arg) {
+  pthread_mutex_lock(&timer_mutex);
+  while (true) {
+    const double now = milliseconds();
+    if (timer_fired_at == 0.0 && now >= timeout) {
+      timer_fired_at = now;
+      stopf = true;
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);  // see reset_abort
+      abortf = true;
+    }
+    if (timer_fired_at != 0.0) {
+      pthread_cond_wait(&timer_cond, &timer_mutex);
+    } else {
+      double wait = timeout - now;
+      if (wait > MAX_TIMER_WAIT_MS) {
+        wait = MAX_TIMER_WAIT_MS;
+      }
+      struct timespec ts = timer_abstime(wait);
+      pthread_cond_timedwait(&timer_cond, &timer_mutex, &ts);
+    }
+  }
+  return NULL;
+}
+
+static void start_abort_timer() {
+  pthread_condattr_t attr;
+  pthread_condattr_init(&attr);
+#if !MACPORT
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+  pthread_cond_init(&timer_cond, &attr);
+  pthread_condattr_destroy(&attr);
+
+  pthread_t timer_thread;
+  if (pthread_create(&timer_thread, NULL, abort_timer_main, NULL) != 0) {
+    fprintf(stderr, "init_abort_timer: could not start the timer thread\n");
+    exit(1);
+  }
+  pthread_detach(timer_thread);
+  timer_started = true;
+}
+
+// Also called during a search, to restart the clock (see ponderhit).
+void init_abort_timer(double max_time) {
+  pthread_mutex_lock(&timer_mutex);
+  if (!timer_started) {
+    start_abort_timer();
+  }
   sstart = milliseconds();
-  // don't go over any more than 3 times the goal
-  timeout = sstart + goal_time * 3.0;
+  timeout = sstart + max_time;
+  timer_fired_at = 0.0;
+  pthread_cond_signal(&timer_cond);
+  pthread_mutex_unlock(&timer_mutex);
+}
+
+bool abort_timer_fired(double *ms_late) {
+  pthread_mutex_lock(&timer_mutex);
+  const bool fired = timer_fired_at != 0.0;
+  if (fired) {
+    *ms_late = milliseconds() - timeout;
+  }
+  pthread_mutex_unlock(&timer_mutex);
+  return fired;
+}
+
+// Only called before a search starts, never by the search itself, so that a
+// stop is not lost.
+void init_stop() {
+  stopf = false;
+}
+
+// Called from outside the search.  Aborts it at once, and keeps it aborted:
+// reset_abort does not start another iteration.
+void stop_search() {
+  stopf = true;
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);  // see reset_abort
+  abortf = true;
 }
 
 double elapsed_time() {
@@ -74,12 +180,15 @@ bool should_abort() {
   return abortf;
 }
 
+// Called before every iteration; a pending stop keeps the search aborted.
+// abortf is cleared before stopf is read: a stop that sets both flags in
+// between would otherwise have its abortf overwritten with the stale stopf.
 void reset_abort() {
   abortf = false;
-}
-
-void init_tics() {
-  tics = 0;
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (stopf) {
+    abortf = true;
+  }
 }
 
 move_t get_move(sortable_move_t sortable_mv) {
@@ -87,7 +196,7 @@ move_t get_move(sortable_move_t sortable_mv) {
 }
 
 static score_t get_draw_score(position_t *p, int ply) {
-  position_t *x = p->history;
+  undo_t *x = p->history;
   uint64_t cur = p->key;
   score_t score;
   while (true) {
@@ -120,7 +229,7 @@ static bool is_repeated(position_t *p, int ply) {
     return false;  // no draw detected
   }
 
-  position_t *x = p->history;
+  undo_t *x = p->history;
   uint64_t cur = p->key;
 
   while (true) {
@@ -201,9 +310,14 @@ leafEvalResult evaluate_as_leaf(searchNode *node, searchType_t type) {
   result.should_enter_quiescence = false;
   result.hash_table_move = 0;
 
+  if (node->depth <= 0) {
+    tables->qnodes++;
+  }
+
   // get transposition table record if available.
-  ttRec_t *rec = tt_hashtable_get(node->position.key);
+  ttRec_t *rec = tt_hashtable_get(node->position->key);
   if (rec) {
+    tables->tt_hits++;
     if (type == SEARCH_SCOUT && tt_is_usable(rec, node->depth, node->beta)) {
       result.type = MOVE_EVALUATED;
       result.score = tt_adjust_score_from_hashtable(rec, node->ply);
@@ -212,8 +326,11 @@ leafEvalResult evaluate_as_leaf(searchNode *node, searchType_t type) {
     result.hash_table_move = tt_move_of(rec);
   }
 
+  // The lasers are analyzed once here, for eval and for move generation
+  get_laser_info(node->position, &node->laser_info);
+
   // stand pat (having-the-move) bonus
-  score_t sps = eval(&(node->position), false) + HMB;
+  score_t sps = cached_eval(node->position, &node->laser_info) + HMB;
   bool quiescence = (node->depth <= 0);  // are we in quiescence?
   result.should_enter_quiescence = quiescence;
   if (quiescence) {
@@ -251,17 +368,15 @@ leafEvalResult evaluate_as_leaf(searchNode *node, searchType_t type) {
   return result;
 }
 
-// Evaluate the move by performing a search.
-void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
-                                  move_t killer_b, searchType_t type,
-                                  uint64_t *node_count_serial,
-                                  moveEvaluationResult *result) {
+// Search the position reached by mv, which has already been made on
+//   result->next_node.position and produced victims.
+static void evaluate_made_move(searchNode *node, move_t mv, victims_t victims,
+                               move_t killer_a, move_t killer_b,
+                               searchType_t type,
+                               moveEvaluationResult *result) {
   int ext = 0;  // extensions
   bool blunder = false;  // shoot our own piece
 
-  victims_t victims = make_move(&(node->position), &(result->next_node.position),
-                                mv);
-
   // Check whether this move changes the board state.
   //   such moves are not legal.
   if (is_KO(victims)) {
@@ -284,9 +399,9 @@ void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
   }
 
   // Check whether the board state has been repeated, this results in a draw.
-  if (is_repeated(&(result->next_node.position), node->ply)) {
+  if (is_repeated(result->next_node.position, node->ply)) {
     result->type = MOVE_GAMEOVER;
-    result->score = get_draw_score(&(result->next_node.position), node->ply);
+    result->score = get_draw_score(result->next_node.position, node->ply);
     return;
   }
 
@@ -337,8 +452,7 @@ void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
   //  reduced-depth search did not trigger a cut-off.
   if (next_reduction > 0) {
     search_depth -= next_reduction;
-    int reduced_depth_score = -scout_search(&(result->next_node), search_depth,
-                                            node_count_serial);
+    int reduced_depth_score = -scout_search(&(result->next_node), search_depth);
     if (reduced_depth_score < node->beta) {
       result->score = reduced_depth_score;
       return;
@@ -355,22 +469,38 @@ void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
 
 
   if (type == SEARCH_SCOUT) {
-    result->score = -scout_search(&(result->next_node), search_depth,
-                                 node_count_serial);
+    result->score = -scout_search(&(result->next_node), search_depth);
   } else {
     if (node->legal_move_count == 0 || node->quiescence) {
-      result->score = -searchPV(&(result->next_node), search_depth, node_count_serial);
+      result->score = -searchPV(&(result->next_node), search_depth);
     } else {
-      result->score = -scout_search(&(result->next_node), search_depth,
-                            node_count_serial);
-      if (result->score > node->alpha) {
-        result->score = -searchPV(&(result->next_node), node->depth + ext - 1, node_count_serial);
+      result->score = -scout_search(&(result->next_node), search_depth);
+      if (result->score > node->alpha && !node->defer_research) {
+        result->score = -searchPV(&(result->next_node), node->depth + ext - 1);
       }
     }
   }
   return;
 }
 
+// Evaluate the move by performing a search.
+//
+// The move is made in place on result->next_node.position, which the caller
+//   points either at node->position itself (serial search) or at a private
+//   copy of it (parallel search), and is taken back before returning.
+void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
+                                  move_t killer_b, searchType_t type,
+                                  moveEvaluationResult *result) {
+  position_t *p = result->next_node.position;
+  undo_t undo;
+
+  use_search_tables();  // a worker may get here first in this search
+
+  victims_t victims = do_move(p, mv, &undo);
+  evaluate_made_move(node, mv, victims, killer_a, killer_b, type, result);
+  undo_move(p, &undo);
+}
+
 // Incremental sort of the move list.
 // This is the original implementation. This code just runs insertion sort on the different moves.
 void sort_incremental(sortable_move_t *move_list, int num_of_moves, int mv_index) {
@@ -402,78 +532,190 @@ void sort_incremental_new(sortable_move_t *move_list, int num_of_moves, int mv_i
   move_list[mv_index] = insert;
 }
 
+// Bookkeeping for a beta cutoff by mv, the mv_index-th move tried at node.
+static void record_cutoff(searchNode *node, move_t mv, int mv_index) {
+  tables->cutoffs++;
+  if (mv_index == 0) {
+    tables->first_move_cutoffs++;
+  }
+  if (mv != killer[KMT(node->ply, 0)] && ENABLE_TABLES) {
+    killer[KMT(node->ply, 1)] = killer[KMT(node->ply, 0)];
+    killer[KMT(node->ply, 0)] = mv;
+  }
+}
+
 // Returns true if a cutoff was triggered, false otherwise.
 bool search_process_score(searchNode *node, move_t mv, int mv_index,
                                 moveEvaluationResult *result, searchType_t type) {
   if (result->score > node->best_score) {
     node->best_score = result->score;
     node->best_move_index = mv_index;
-    node->subpv[0] = mv;
-
-    // write best move into right position in PV buffer.
-    memcpy(node->subpv + 1, result->next_node.subpv,
-           sizeof(move_t) * (MAX_PLY_IN_SEARCH - 1));
-    node->subpv[MAX_PLY_IN_SEARCH - 1] = 0;
+    node->best_move = mv;
+    if (type == SEARCH_PV) {
+      pv_update(node->ply, mv);
+    }
 
     if (type != SEARCH_SCOUT && result->score > node->alpha) {
       node->alpha = result->score;
     }
 
     if (result->score >= node->beta) {
-      if (mv != killer[KMT(node->ply, 0)] && ENABLE_TABLES) {
-        killer[KMT(node->ply, 1)] = killer[KMT(node->ply, 0)];
-        killer[KMT(node->ply, 0)] = mv;
-      }
+      record_cutoff(node, mv, mv_index);
       return true;
     }
   }
   return false;
 }
 
-// Check if we should abort.
-bool should_abort_check() {
-  tics++;
-  if ((tics & ABORT_CHECK_PERIOD) == 0) {
-    if (milliseconds() >= timeout) {
-      abortf = true;
+// -----------------------------------------------------------------------------
+// Staged move picker
+//
+// Hands out the moves of a node one at a time: the hash move, the two killer
+// moves, then the rest of the moves by best_move_history.  The hash move and
+// the killers are only checked for pseudo-legality, so a cutoff on one of
+// them costs no move generation.  Quiescence nodes only search captures, so
+// there the rest of the moves come from generate_noisy.
+//
+// The moves handed out so far are kept at the front of move_list, in order,
+// so that move_list can be passed to update_best_move_history.
+// -----------------------------------------------------------------------------
+
+typedef enum {
+  PICK_HASH_MOVE,
+  PICK_KILLER_A,
+  PICK_KILLER_B,
+  PICK_GENERATE,
+  PICK_SORTED,
+  PICK_DONE
+} pickStage_t;
+
+typedef struct movePicker {
+  position_t *position;
+  const laser_info_t *laser_info;  // of position
+  pickStage_t stage;
+  bool noisy_only;  // generate only moves that may capture
+  move_t hash_move;
+  move_t killer_a;
+  move_t killer_b;
+  int num_picked;  // move_list[0 .. num_picked) have been handed out
+  int num_moves;   // size of move_list once all moves are generated
+  sortable_move_t move_list[MAX_NUM_MOVES];
+} movePicker;
+
+static void init_move_picker(movePicker *mp, searchNode *node,
+                             move_t hash_table_move) {
+  mp->position = node->position;
+  mp->laser_info = &node->laser_info;
+  mp->stage = PICK_HASH_MOVE;
+  mp->noisy_only = node->quiescence;
+  mp->hash_move = hash_table_move;
+  mp->killer_a = killer[KMT(node->ply, 0)];
+  mp->killer_b = killer[KMT(node->ply, 1)];
+  mp->num_picked = 0;
+  mp->num_moves = 0;
+}
+
+static bool already_picked(const movePicker *mp, move_t mv) {
+  for (int i = 0; i < mp->num_picked; i++) {
+    if (get_move(mp->move_list[i]) == mv) {
       return true;
     }
   }
   return false;
 }
 
-// Obtain a sorted move list.
-static int get_sortable_move_list(searchNode *node, sortable_move_t * move_list,
-                         int hash_table_move) {
-  // number of moves in list
-
-  int num_of_moves = generate_all(&(node->position), move_list, false);
-  color_t fake_color_to_move = color_to_move_of(&(node->position));
-
-  move_t killer_a = killer[KMT(node->ply, 0)];
-  move_t killer_b = killer[KMT(node->ply, 1)];
+// Hands out mv ahead of move generation if it is a legal move here.
+static bool pick_early(movePicker *mp, move_t mv) {
+  if (mv == 0 || already_picked(mp, mv) || !is_pseudo_legal(mp->position, mv)) {
+    return false;
+  }
+  mp->move_list[mp->num_picked++] = mv;
+  return true;
+}
 
-  // sort special moves to the front
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
-    move_t mv = get_move(move_list[mv_index]);
-    if (mv == hash_table_move) {
-      set_sort_key(&move_list[mv_index], SORT_MASK);
-    } else if (mv == killer_a) {
-      set_sort_key(&move_list[mv_index], SORT_MASK - 1);
-    } else if (mv == killer_b) {
-      set_sort_key(&move_list[mv_index], SORT_MASK - 2);
-    } else {
-      ptype_t  pce = ptype_mv_of(mv);
-      rot_t    ro  = rot_of(mv);   // rotation
-      square_t fs  = from_square(mv);
-      int      ot  = ORI_MASK & (ori_of(node->position.board[fs]) + ro);
-      square_t ts  = to_square(mv);
-      set_sort_key(&move_list[mv_index],
-                   best_move_history[BMH(fake_color_to_move, pce, ts, ot)]);
+// Generates the moves that have not been handed out yet behind the ones
+// that have, and gives them their sort keys.
+static void generate_remaining(movePicker *mp) {
+  position_t *p = mp->position;
+  sortable_move_t *list = mp->move_list + mp->num_picked;
+  int n = mp->noisy_only ? generate_noisy(p, list, mp->laser_info)
+      : generate_all(p, list, false, mp->laser_info);
+  color_t fake_color_to_move = color_to_move_of(p);
+
+  for (int i = 0; i < n; i++) {
+    move_t mv = get_move(list[i]);
+    if (already_picked(mp, mv)) {
+      list[i--] = list[--n];
+      continue;
     }
+    ptype_t  pce = ptype_mv_of(mv);
+    rot_t    ro  = rot_of(mv);   // rotation
+    square_t fs  = from_square(mv);
+    int      ot  = ORI_MASK & (ori_of(piece_at(p, fs)) + ro);
+    square_t ts  = to_square(mv);
+    set_sort_key(&list[i],
+                 best_move_history[BMH(fake_color_to_move, pce, ts, ot)]);
   }
+  mp->num_moves = mp->num_picked + n;
+}
 
-  return num_of_moves;
+// Returns the next move to search, or 0 when there are no more.
+static move_t next_move(movePicker *mp) {
+  if (mp->stage == PICK_HASH_MOVE) {
+    mp->stage = PICK_KILLER_A;
+    if (pick_early(mp, mp->hash_move)) {
+      return mp->hash_move;
+    }
+  }
+  if (mp->stage == PICK_KILLER_A) {
+    mp->stage = PICK_KILLER_B;
+    if (pick_early(mp, mp->killer_a)) {
+      return mp->killer_a;
+    }
+  }
+  if (mp->stage == PICK_KILLER_B) {
+    mp->stage = PICK_GENERATE;
+    if (pick_early(mp, mp->killer_b)) {
+      return mp->killer_b;
+    }
+  }
+  if (mp->stage == PICK_GENERATE) {
+    generate_remaining(mp);
+    mp->stage = PICK_SORTED;
+  }
+  if (mp->stage == PICK_SORTED) {
+    if (mp->num_picked < mp->num_moves) {
+      sort_incremental_new(mp->move_list, mp->num_moves, mp->num_picked);
+      return get_move(mp->move_list[mp->num_picked++]);
+    }
+    mp->stage = PICK_DONE;
+  }
+  return 0;
 }
 
+// Generates whatever is left and sorts it, for searching the remaining moves
+// in parallel.  Afterwards move_list[num_picked .. num_moves) holds the
+// remaining moves in the order next_move would have returned them.
+static void pick_all_remaining(movePicker *mp) {
+  const int num_handed_out = mp->num_picked;
 
+  // Moves not generated yet go behind the hash move and killers that have
+  // not been handed out either, which keep their place in line.
+  if (mp->stage <= PICK_HASH_MOVE) {
+    pick_early(mp, mp->hash_move);
+  }
+  if (mp->stage <= PICK_KILLER_A) {
+    pick_early(mp, mp->killer_a);
+  }
+  if (mp->stage <= PICK_KILLER_B) {
+    pick_early(mp, mp->killer_b);
+  }
+  if (mp->stage <= PICK_GENERATE) {
+    generate_remaining(mp);
+  }
+  for (int i = mp->num_picked; i < mp->num_moves; i++) {
+    sort_incremental_new(mp->move_list, mp->num_moves, i);
+  }
+  mp->num_picked = num_handed_out;
+  mp->stage = PICK_DONE;
+}
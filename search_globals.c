@@ -2,7 +2,6 @@
 
 #define __KMT_dim__ [MAX_PLY_IN_SEARCH*4]  // NOLINT(whitespace/braces)
 #define KMT(ply, id) (4 * ply + id)
-static move_t killer __KMT_dim__;  // up to 4 killers
 
 // Best move history table and lookup function
 // Format: best_move_history[color_t][piece_t][square_t][orientation]
@@ -11,10 +10,171 @@ static move_t killer __KMT_dim__;  // up to 4 killers
     (color * 6 * ARR_SIZE * NUM_ORI + piece * ARR_SIZE * NUM_ORI + \
      square * NUM_ORI + ori)
 
-static int best_move_history __BMH_dim__;
+// Every worker has its own killer and history tables, so that workers do
+// not write to each other's cache lines.  A worker's history is cleared the
+// first time it searches in a new search (see init_best_move_history); its
+// killers are kept across searches, as they always were.
+//
+// The same goes for the search statistics: each worker counts its own nodes,
+// and the counts are only summed when they are printed.
+typedef struct searchTables {
+  move_t killer __KMT_dim__;  // up to 4 killers
+  int best_move_history __BMH_dim__;
+  uint32_t generation;  // search that best_move_history belongs to
+  uint64_t cutoffs;     // beta cutoffs in this search
+  uint64_t first_move_cutoffs;  // ... by the first move tried
+  uint64_t nodes;       // moves tried in this search
+  uint64_t qnodes;      // quiescence nodes searched in this search
+  uint64_t tt_hits;     // transposition table probes that found a record
+} __attribute__((aligned(64))) searchTables;
+
+static searchTables search_tables[MAX_WORKERS];
+static volatile uint32_t search_generation = 1;
+
+// The calling thread's tables, set by use_search_tables()
+static __thread searchTables *tables = NULL;
+static __thread move_t *killer = NULL;
+static __thread int *best_move_history = NULL;
+static __thread uint32_t tables_generation = 0;
+
+static void bind_search_tables() {
+  tables = &search_tables[sched_worker_id()];
+  killer = tables->killer;
+  best_move_history = tables->best_move_history;
+  tables_generation = search_generation;
+  if (tables->generation != tables_generation) {
+    memset(tables->best_move_history, 0, sizeof(tables->best_move_history));
+    tables->generation = tables_generation;
+    tables->cutoffs = 0;
+    tables->first_move_cutoffs = 0;
+    __atomic_store_n(&tables->nodes, 0, __ATOMIC_RELAXED);
+    tables->qnodes = 0;
+    tables->tt_hits = 0;
+  }
+}
+
+// Must be called by a search thread before it uses the tables.
+static inline void use_search_tables() {
+  if (tables_generation != search_generation) {
+    bind_search_tables();
+  }
+}
+
+// Nodes the search may try, or 0 for no limit.  The workers compare the
+// total with it every NODE_LIMIT_PERIOD nodes of their own.
+#define NODE_LIMIT_PERIOD 1024
+static uint64_t node_limit = 0;
+
+void set_node_limit(uint64_t nodes) {
+  node_limit = nodes;
+}
+
+static void check_node_limit() {
+  if (search_node_count() >= node_limit) {
+    stop_search();
+  }
+}
+
+// Counts a move tried by the calling worker.  The root reads the counts of
+// all workers while they search, hence the atomic store; it is a plain
+// store on x86, as only this worker writes the counter.
+static inline void count_node() {
+  const uint64_t nodes = tables->nodes + 1;
+  __atomic_store_n(&tables->nodes, nodes, __ATOMIC_RELAXED);
+  if (node_limit != 0 && nodes % NODE_LIMIT_PERIOD == 0) {
+    check_node_limit();
+  }
+}
+
+// Triangular PV table of the calling thread.  The PV found by the PV node
+// on ply p is pv_table[p][p .. pv_length[p] - 1].  A PV node empties the row
+// of its children before searching each move, so that after the move the
+// row holds the child's PV, or nothing if the child was not a PV node.
+static __thread move_t pv_table[MAX_PLY_IN_SEARCH][MAX_PLY_IN_SEARCH];
+static __thread int pv_length[MAX_PLY_IN_SEARCH];
+
+static inline void pv_clear(int ply) {
+  pv_length[ply] = ply;
+}
+
+// Makes mv followed by the PV of ply + 1 the PV of ply.
+static void pv_update(int ply, move_t mv) {
+  pv_table[ply][ply] = mv;
+  for (int i = ply + 1; i < pv_length[ply + 1]; i++) {
+    pv_table[ply][i] = pv_table[ply + 1][i];
+  }
+  pv_length[ply] = pv_length[ply + 1];
+}
 
 void init_best_move_history() {
-  memset(best_move_history, 0, sizeof(best_move_history));
+  search_generation++;
+}
+
+// Not for use while searching.
+void clear_killers() {
+  for (int i = 0; i < MAX_WORKERS; i++) {
+    memset(search_tables[i].killer, 0, sizeof(search_tables[i].killer));
+  }
+}
+
+// Makes the history of every worker that has searched in this search the
+// entrywise maximum of all of them.  Called between iterations, while no
+// worker is searching.
+static void merge_best_move_history() {
+  searchTables *merged[MAX_WORKERS];
+  int n = 0;
+  for (int i = 0; i < sched_num_workers(); i++) {
+    if (search_tables[i].generation == search_generation) {
+      merged[n++] = &search_tables[i];
+    }
+  }
+  if (n < 2) {
+    return;
+  }
+  for (int j = 0; j < (int) (sizeof(merged[0]->best_move_history) / sizeof(int)); j++) {
+    int s = merged[0]->best_move_history[j];
+    for (int i = 1; i < n; i++) {
+      if (merged[i]->best_move_history[j] > s) {
+        s = merged[i]->best_move_history[j];
+      }
+    }
+    for (int i = 0; i < n; i++) {
+      merged[i]->best_move_history[j] = s;
+    }
+  }
+}
+
+void search_cutoff_stats(uint64_t *cutoffs, uint64_t *first_move_cutoffs) {
+  *cutoffs = 0;
+  *first_move_cutoffs = 0;
+  for (int i = 0; i < MAX_WORKERS; i++) {
+    if (search_tables[i].generation == search_generation) {
+      *cutoffs += search_tables[i].cutoffs;
+      *first_move_cutoffs += search_tables[i].first_move_cutoffs;
+    }
+  }
+}
+
+uint64_t search_node_count() {
+  uint64_t nodes = 0;
+  for (int i = 0; i < MAX_WORKERS; i++) {
+    if (search_tables[i].generation == search_generation) {
+      nodes += __atomic_load_n(&search_tables[i].nodes, __ATOMIC_RELAXED);
+    }
+  }
+  return nodes;
+}
+
+bool search_worker_stats(int worker, uint64_t *nodes, uint64_t *qnodes,
+                         uint64_t *tt_hits) {
+  const searchTables *t = &search_tables[worker];
+  if (t->generation != search_generation) {
+    return false;
+  }
+  *nodes = __atomic_load_n(&t->nodes, __ATOMIC_RELAXED);
+  *qnodes = t->qnodes;
+  *tt_hits = t->tt_hits;
+  return true;
 }
 
 static void update_best_move_history(position_t *p, int index_of_best,
@@ -28,7 +188,7 @@ static void update_best_move_history(position_t *p, int index_of_best,
     ptype_t  pce = ptype_mv_of(mv);
     rot_t    ro  = rot_of(mv);  // rotation
     square_t fs  = from_square(mv);
-    int      ot  = ORI_MASK & (ori_of(p->board[fs]) + ro);
+    int      ot  = ORI_MASK & (ori_of(piece_at(p, fs)) + ro);
     square_t ts  = to_square(mv);
 
     int  s = best_move_history[BMH(color_to_move, pce, ts, ot)];
@@ -47,24 +207,24 @@ static void update_best_move_history(position_t *p, int index_of_best,
 static void update_transposition_table(searchNode* node) {
   if (node->type == SEARCH_SCOUT) {
     if (node->best_score < node->beta) {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply),
                        UPPER, 0);
     } else {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply),
-                       LOWER, node->subpv[0]);
+                       LOWER, node->best_move);
     }
   } else if (node->type == SEARCH_PV) {
     if (node->best_score <= node->orig_alpha) {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
           tt_adjust_score_for_hashtable(node->best_score, node->ply), UPPER, 0);
     } else if (node->best_score >= node->beta) {
-      tt_hashtable_put(node->position.key, node->depth,
-          tt_adjust_score_for_hashtable(node->best_score, node->ply), LOWER, node->subpv[0]);
+      tt_hashtable_put(node->position->key, node->depth,
+          tt_adjust_score_for_hashtable(node->best_score, node->ply), LOWER, node->best_move);
     } else {
-      tt_hashtable_put(node->position.key, node->depth,
-          tt_adjust_score_for_hashtable(node->best_score, node->ply), EXACT, node->subpv[0]);
+      tt_hashtable_put(node->position->key, node->depth,
+          tt_adjust_score_for_hashtable(node->best_score, node->ply), EXACT, node->best_move);
     }
   }
 }
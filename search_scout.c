@@ -7,21 +7,64 @@
 
 #include "./tbassert.h"
 #include "./simple_mutex.h"
-#include <cilk/cilk_api.h>
+#include "./scheduler.h"
 
 #define YOUNG_BROTHERS_WAIT 5
 
+// -----------------------------------------------------------------------------
+// Abort cells (see abortCell in search.h)
+//
+// A scout node that searches its moves in parallel links a cell of its own
+// below the cell of its nearest parallel ancestor, and unlinks it when its
+// loop is done.  The running parallel nodes thus form a tree of cells.
+// Aborting a cell aborts its whole subtree, so a node only has to look at
+// its own abort_cell.  Locks are always taken from the top of the tree
+// down, and linking or unlinking takes a single lock.
+// -----------------------------------------------------------------------------
+
+static void abort_cell_link(abortCell *cell, abortCell *parent) {
+  init_simple_mutex(&cell->lock);
+  cell->parent = parent;
+  cell->first_child = NULL;
+  cell->prev_sibling = NULL;
+
+  simple_acquire(&parent->lock);
+  cell->next_sibling = parent->first_child;
+  if (parent->first_child != NULL) {
+    parent->first_child->prev_sibling = cell;
+  }
+  parent->first_child = cell;
+  cell->aborted = parent->aborted;  // too late to be reached by the abort
+  simple_release(&parent->lock);
+}
+
+static void abort_cell_unlink(abortCell *cell) {
+  abortCell *parent = cell->parent;
+  simple_acquire(&parent->lock);
+  if (cell->prev_sibling != NULL) {
+    cell->prev_sibling->next_sibling = cell->next_sibling;
+  } else {
+    parent->first_child = cell->next_sibling;
+  }
+  if (cell->next_sibling != NULL) {
+    cell->next_sibling->prev_sibling = cell->prev_sibling;
+  }
+  simple_release(&parent->lock);
+}
+
+static void abort_cell_abort(abortCell *cell) {
+  simple_acquire(&cell->lock);
+  cell->aborted = true;
+  for (abortCell *c = cell->first_child; c != NULL; c = c->next_sibling) {
+    abort_cell_abort(c);
+  }
+  simple_release(&cell->lock);
+}
+
 // Checks whether a node's parent has aborted.
 //   If this occurs, we should just stop and return 0 immediately.
-bool parallel_parent_aborted(searchNode* node) {
-  searchNode* pred = node->parent;
-  while (pred != NULL) {
-    if (pred->abort) {
-      return true;
-    }
-    pred = pred->parent;
-  }
-  return false;
+static inline bool parallel_parent_aborted(searchNode* node) {
+  return node->abort_cell->aborted;
 }
 
 // Checks whether this node has aborted due to a cut-off.
@@ -40,23 +83,118 @@ static void initialize_scout_node(searchNode *node, const int depth) {
   node->alpha = node->beta - 1;
   node->depth = depth;
   node->ply = node->parent->ply + 1;
-  node->subpv[0] = 0;
+  node->best_move = 0;
   node->legal_move_count = 0;
-  node->fake_color_to_move = color_to_move_of(&(node->position));
+  node->fake_color_to_move = color_to_move_of(node->position);
   // point of view = 1 for white, -1 for black
   node->pov = 1 - node->fake_color_to_move * 2;
   node->best_move_index = 0;  // index of best move found
   node->abort = false;
+  node->abort_cell = node->parent->child_cell;
+  node->child_cell = node->abort_cell;
+}
+
+// The best score and the index of its move at a scout node, packed into one
+// word that is larger for a larger score, or for the same score by a move
+// tried earlier.  The parallel move loop merges its results with a CAS on
+// this word instead of taking a lock.
+typedef uint32_t packedScore;
+
+static inline packedScore pack_score(score_t score, int mv_index) {
+  return ((uint32_t) (score - INT16_MIN) << 16) | (uint32_t) (0xffff - mv_index);
+}
+
+static inline score_t packed_score_of(packedScore packed) {
+  return (score_t) ((int) (packed >> 16) + INT16_MIN);
 }
 
-static score_t scout_search(searchNode *node, const int depth,
-                            uint64_t *node_count_serial) {
-  __cilkrts_set_param("nworkers","1");
+static inline int packed_index_of(packedScore packed) {
+  return 0xffff - (int) (packed & 0xffff);
+}
+
+// State shared by the parallel iterations of scout_search's move loop
+typedef struct scoutLoop {
+  searchNode *node;
+  const sortable_move_t *move_list;
+  int *number_of_moves_evaluated;
+  bool parallel;  // iterations may run at the same time
+  packedScore best;  // of node, when parallel
+  move_t killer_a;
+  move_t killer_b;
+} scoutLoop;
+
+// One iteration of the parallel move loop.  Iterations take moves in order
+// from number_of_moves_evaluated rather than by their loop index.
+static void scout_search_move(void *arg, int mv_index) {
+  scoutLoop *loop = (scoutLoop *) arg;
+  searchNode *node = loop->node;
+  if (node->abort) return;
+  // Get the next move from the move list.
+  int local_index = __sync_fetch_and_add(loop->number_of_moves_evaluated, 1);
+  move_t mv = get_move(loop->move_list[local_index]);
+
+  if (TRACE_MOVES) {
+    print_move_info(mv, node->ply);
+  }
+
+  use_search_tables();
+  count_node();
+
+  // Parallel iterations cannot share node->position, so each one makes
+  // its move on a private copy.
+  position_t position = *node->position;
+
+  moveEvaluationResult result;
+  result.next_node.parent = node;
+  result.next_node.position = &position;
+
+  evaluateMove(node, mv, loop->killer_a, loop->killer_b,
+               SEARCH_SCOUT,
+               &result);
+
+  if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE
+      || abortf || parallel_parent_aborted(node)) {
+    return;
+  }
+
+  // A legal move is a move that's not KO, but when we are in quiescence
+  // we only want to count moves that has a capture.
+  if (result.type == MOVE_EVALUATED) {
+    __sync_fetch_and_add(&node->legal_move_count, 1);
+  }
+
+  if (!loop->parallel) {
+    // process the score. Note that this mutates fields in node.
+    if (search_process_score(node, mv, local_index, &result, SEARCH_SCOUT)) {
+      node->abort = true;
+    }
+    return;
+  }
+
+  // Only the winner's score and move are written to node, after the loop.
+  const packedScore packed = pack_score(result.score, local_index);
+  packedScore best = __atomic_load_n(&loop->best, __ATOMIC_RELAXED);
+  while (packed > best) {
+    if (__atomic_compare_exchange_n(&loop->best, &best, packed, true,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+      if (result.score >= node->beta) {
+        record_cutoff(node, mv, local_index);
+        node->abort = true;
+        abort_cell_abort(node->child_cell);
+      }
+      break;
+    }
+  }
+}
+
+static score_t scout_search(searchNode *node, const int depth) {
+  use_search_tables();
+
   // Initialize the search node.
   initialize_scout_node(node, depth);
 
   // check whether we should abort
-  if (should_abort_check() || parallel_parent_aborted(node)) {
+  if (abortf || parallel_parent_aborted(node)) {
     return 0;
   }
 
@@ -78,56 +216,29 @@ static score_t scout_search(searchNode *node, const int depth,
   const move_t killer_a = killer[KMT(node->ply, 0)];
   const move_t killer_b = killer[KMT(node->ply, 1)];
 
-  // Store the sorted move list on the stack.
-  //   MAX_NUM_MOVES is all that we need.
-  sortable_move_t move_list[MAX_NUM_MOVES];
-
-  // Obtain the sorted move list.
-  const int num_of_moves = get_sortable_move_list(node, move_list, hash_table_move);
-  
-  // For our parallel code we'll want to iterate over the first few values serially, then go parallel
-  // This variable sets how many nodes we'll search serially
-  // const int first_iteration_value = num_of_moves >= 5 ? 5 : num_of_moves;
-
-  int number_of_moves_evaluated = 0;
-
-  // A simple mutex. See simple_mutex.h for implementation details.
-  simple_mutex_t node_mutex;
-  init_simple_mutex(&node_mutex);
-
-  // Sort the move list.
-  //  sort_incremental_new(move_list, num_of_moves, number_of_moves_evaluated);
-  
-  // This is the original code here, think it might be in place for parallelizing, so keeping it here
-  // but commented out for now
+  // Moves come from a staged picker, see search_common.c.
+  movePicker picker;
+  init_move_picker(&picker, node, hash_table_move);
 
   moveEvaluationResult result;
-  result.next_node.subpv[0] = 0;
   result.next_node.parent = node;
+  result.next_node.position = node->position;  // moves are made in place
 
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
-    // We have searched as many serial nodes as we need to. Break and start searching parallely
-    if (node->legal_move_count > YOUNG_BROTHERS_WAIT) {
-      break;
-    }
-
-    // Sort the move list.
-    sort_incremental_new(move_list, num_of_moves, number_of_moves_evaluated);
-    // Get the next move from the move list.
-    int local_index = number_of_moves_evaluated++;
-    // Added this line to use our new incremental_sort implementation, wasn't originally here
-    move_t mv = get_move(move_list[local_index]);
+  // We search the first few moves serially, then the rest in parallel once
+  // more than YOUNG_BROTHERS_WAIT legal moves failed to produce a cutoff.
+  move_t mv;
+  while (node->legal_move_count <= YOUNG_BROTHERS_WAIT &&
+         (mv = next_move(&picker)) != 0) {
+    int local_index = picker.num_picked - 1;
 
     if (TRACE_MOVES) {
       print_move_info(mv, node->ply);
     }
 
-    // increase node count
-    __sync_fetch_and_add(node_count_serial, 1);
+    count_node();
 
     evaluateMove(node, mv, killer_a, killer_b,
                  SEARCH_SCOUT,
-                 node_count_serial,
                  &result);
 
     if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE
@@ -158,57 +269,39 @@ static score_t scout_search(searchNode *node, const int depth,
   // We have not found a cutoff, continue to search parallely
   if (!(node->abort)) {
 
-  int start_value = number_of_moves_evaluated;
-
-  sort_incremental(move_list, num_of_moves, number_of_moves_evaluated);
-  
-  cilk_for (int mv_index = start_value; mv_index < num_of_moves; mv_index++) {
-    do {
-      if (node->abort) continue;
-      // Get the next move from the move list.
-      int local_index = __sync_fetch_and_add(&number_of_moves_evaluated, 1);
-      // Added this line to use our new incremental_sort implementation, wasn't originally here
-      // sort_incremental_new(move_list, num_of_moves, local_index);
-      move_t mv = get_move(move_list[local_index]);
-
-      if (TRACE_MOVES) {
-        print_move_info(mv, node->ply);
-      }
-
-      // increase node count
-      __sync_fetch_and_add(node_count_serial, 1);
-
-      moveEvaluationResult result;
-      result.next_node.subpv[0] = 0;
-      result.next_node.parent = node;
-
-      evaluateMove(node, mv, killer_a, killer_b,
-                            SEARCH_SCOUT,
-                            node_count_serial,
-                            &result);
-
-      if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE
-          || abortf || parallel_parent_aborted(node)) {
-        continue;
-      }
-
-      // A legal move is a move that's not KO, but when we are in quiescence
-      // we only want to count moves that has a capture.
-      if (result.type == MOVE_EVALUATED) {
-        // node->legal_move_count++;
-        __sync_fetch_and_add(&node->legal_move_count, 1); 
-      }
-
-      // process the score. Note that this mutates fields in node.
-      simple_acquire(&node_mutex);
-      bool cutoff = search_process_score(node, mv, local_index, &result, SEARCH_SCOUT);
-      simple_release(&node_mutex);
-      if (cutoff) {
-        node->abort = true;
-        continue;
-      }
-    } while (false);
+  pick_all_remaining(&picker);
+  int number_of_moves_evaluated = picker.num_picked;
+
+  scoutLoop loop = {
+    .node = node,
+    .move_list = picker.move_list,
+    .number_of_moves_evaluated = &number_of_moves_evaluated,
+    .parallel = !LAZY_SMP && sched_num_workers() > 1,
+    .best = pack_score(node->best_score, node->best_move_index),
+    .killer_a = killer_a,
+    .killer_b = killer_b
+  };
+  if (!loop.parallel) {
+    // The workers are busy with Lazy SMP helpers (see search.c), or there
+    // are none.  A cutoff just ends the loop.
+    for (int i = picker.num_picked; i < picker.num_moves; i++) {
+      scout_search_move(&loop, i);
+    }
+  } else {
+    abortCell cell;
+    abort_cell_link(&cell, node->abort_cell);
+    node->child_cell = &cell;
+    sched_parallel_for(picker.num_picked, picker.num_moves, scout_search_move, &loop);
+    node->child_cell = node->abort_cell;
+    abort_cell_unlink(&cell);
+
+    if (loop.best != pack_score(node->best_score, node->best_move_index)) {
+      node->best_score = packed_score_of(loop.best);
+      node->best_move_index = packed_index_of(loop.best);
+      node->best_move = get_move(picker.move_list[node->best_move_index]);
+    }
   }
+  picker.num_picked = number_of_moves_evaluated;
 
   }
 
@@ -217,14 +310,14 @@ static score_t scout_search(searchNode *node, const int depth,
   }
 
   if (node->quiescence == false) {
-    update_best_move_history(&(node->position), node->best_move_index,
-                             move_list, number_of_moves_evaluated);
+    update_best_move_history(node->position, node->best_move_index,
+                             picker.move_list, picker.num_picked);
   }
 
   tbassert(abs(node->best_score) != -INF, "best_score = %d\n",
            node->best_score);
 
-  // Reads node->position.key, node->depth, node->best_score, and node->ply
+  // Reads node->position->key, node->depth, node->best_score, and node->ply
   update_transposition_table(node);
 
   return node->best_score;
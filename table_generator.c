@@ -1,193 +1,181 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Generates precomp_tables.h, the lookup tables used by eval.c, on stdout:
+//
+//   make precomp_tables.h
+//
+// All tables are integers so that eval needs no floating point or division.
+// Terms that are scaled by a weight set at run time (PCENTRAL, KFACE,
+// KAGGRESSIVE) are stored as fixed-point fractions with EVAL_TABLE_SHIFT
+// bits; eval multiplies by the weight and shifts.
+
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 
-#define __STDC_FORMAT_MACROS
-#include <inttypes.h>
-
+// These must agree with move_gen.h
 #define BOARD_WIDTH 10
-#define ARR_WIDTH 16
-#define FIL_ORIGIN ((ARR_WIDTH - BOARD_WIDTH) / 2)
-#define FIL_SHIFT 4
-#define FIL_MASK 15
-#define RNK_ORIGIN ((ARR_WIDTH - BOARD_WIDTH) / 2)
-#define RNK_SHIFT 0
-#define RNK_MASK 15
-
-#define PIECE_SIZE 5  // Number of bits in (ptype, color, orientation)
-
-// MOVE_MASK is 20 bits
-#define MOVE_MASK 0xfffff
-
-#define PTYPE_MV_SHIFT 18
-#define PTYPE_MV_MASK 3
-#define FROM_SHIFT 8
-#define FROM_MASK 0xFF
-#define TO_SHIFT 0
-#define TO_MASK 0xFF
-#define ROT_SHIFT 16
-#define ROT_MASK 3
-
-#define PTYPE_SHIFT 2
-#define PTYPE_MASK 3
-
-typedef int32_t ev_score_t;  // Static evaluator uses "hi res" values
-int PCENTRAL;
+#define BB_SQUARES (BOARD_WIDTH * BOARD_WIDTH)
+#define NUM_ORI 4
+#define KING_DELTAS (2 * BOARD_WIDTH - 1)
+
+#define EVAL_TABLE_SHIFT 16
+#define EVAL_TABLE_ONE (1 << EVAL_TABLE_SHIFT)
+
+// Least common multiple of 1..BOARD_WIDTH, so that h_dist is exact
+#define H_DIST_SCALE 2520
 
 typedef enum {
-  EMPTY,
-  PAWN,
-  KING,
-  INVALID
-} ptype_t;
+  NN,
+  EE,
+  SS,
+  WW
+} king_ori_t;
 
 typedef int fil_t;
 typedef int rnk_t;
-typedef int square_t;
 
-// Finds file of square
-fil_t fil_of(square_t sq) {
-  fil_t f = ((sq >> FIL_SHIFT) & FIL_MASK) - FIL_ORIGIN;
-  return f;
+// Squares are numbered as bits in a bitboard: BOARD_WIDTH * file + rank
+static fil_t fil_of_index(int i) {
+  return i / BOARD_WIDTH;
 }
 
-// Finds rank of square
-rnk_t rnk_of(square_t sq) {
-  rnk_t r = ((sq >> RNK_SHIFT) & RNK_MASK) - RNK_ORIGIN;
-  return r;
+static rnk_t rnk_of_index(int i) {
+  return i % BOARD_WIDTH;
 }
 
-// Harmonic-ish distance: 1/(|dx|+1) + 1/(|dy|+1)
-float h_dist(square_t a, square_t b) {
-  //  printf("a = %d, FIL(a) = %d, RNK(a) = %d\n", a, FIL(a), RNK(a));
-  //  printf("b = %d, FIL(b) = %d, RNK(b) = %d\n", b, FIL(b), RNK(b));
-  int delta_fil = abs(fil_of(a) - fil_of(b));
-  int delta_rnk = abs(rnk_of(a) - rnk_of(b));
-  float x = (1.0 / (delta_fil + 1)) + (1.0 / (delta_rnk + 1));
-  //  printf("max_dist = %d\n\n", x);
-  return x;
+static int32_t to_fixed(double x) {
+  return (int32_t) lround(x * EVAL_TABLE_ONE);
+}
+
+// PCENTRAL heuristic: Bonus for Pawn near center of board
+static double pcentral(fil_t f, rnk_t r) {
+  double df = BOARD_WIDTH/2 - f - 1;
+  if (df < 0)  df = f - BOARD_WIDTH/2;
+  double dr = BOARD_WIDTH/2 - r - 1;
+  if (dr < 0) dr = r - BOARD_WIDTH/2;
+  return 1 - sqrt(df * df + dr * dr) / (BOARD_WIDTH / sqrt(2));
 }
 
-// For no square, use 0, which is guaranteed to be off board
-square_t square_of(fil_t f, rnk_t r) {
-  square_t s = ARR_WIDTH * (FIL_ORIGIN + f) + RNK_ORIGIN + r;
-  return s;
+// Harmonic-ish distance: 1/(|dx|+1) + 1/(|dy|+1), times H_DIST_SCALE
+static int h_dist(int a, int b) {
+  const int delta_fil = abs(fil_of_index(a) - fil_of_index(b)) + 1;
+  const int delta_rnk = abs(rnk_of_index(a) - rnk_of_index(b)) + 1;
+  return H_DIST_SCALE / delta_fil + H_DIST_SCALE / delta_rnk;
 }
 
-// Using our valid square_of method, generate a table that precomputes these values
-void generate_square_table() {
-  FILE *fp = fopen("square_of_table.c", "wb");
-  int x;
-  int y;
-  fprintf(fp, "static const unsigned char square_of_table[13][15] = {\n");
-  for (x = 0; x < 13; x++) {
-    fprintf(fp, "{");
-    for (y = 0; y < 15; y++) {
-      if (square_of(x-3, y-3) < 0) {
-        fprintf(fp, "-'\\x%1x', ", -square_of(x-3,y-3));
-      } else {
-        fprintf(fp, "'\\x%1x', ", square_of(x-3,y-3));
-      }
-    }
-    fprintf(fp, "},\n");
+// KFACE heuristic: how much a King with orientation ori faces the other King,
+// which is delta_fil files and delta_rnk ranks away
+static double kface(king_ori_t ori, int delta_fil, int delta_rnk) {
+  int bonus = 0;
+  switch (ori) {
+    case NN:
+      bonus = delta_rnk;
+      break;
+    case EE:
+      bonus = delta_fil;
+      break;
+    case SS:
+      bonus = -delta_rnk;
+      break;
+    case WW:
+      bonus = -delta_fil;
+      break;
   }
-  fprintf(fp, "};");
-};
-
-// Using our valid h_dist method, generate a file that is formatted as a precomputed table for these values
-void generate_h_dist_table() {
-  FILE *fp = fopen("h_dist_table.c", "wb");
-  int x;
-  int y;
-  fprintf(fp, "static const float h_dist_table[216][216] = {\n");
-  for (x = 0; x < 216; x++) {
-    fprintf(fp, "{");
-    for (y = 0; y < 216; y++) {
-      fprintf(fp, "%f, ", h_dist(x, y));
+  const int dist = abs(delta_rnk) + abs(delta_fil);
+  return dist == 0 ? 0 : (double) bonus / dist;
+}
+
+// KAGGRESSIVE heuristic: the space behind the King on (f, r), away from the
+// other King on (of, _or), as a fraction of the board
+static double kaggressive(fil_t f, rnk_t r, fil_t of, rnk_t _or) {
+  int bonus = (of >= f) ? f + 1 : BOARD_WIDTH - f;
+  bonus *= (_or >= r) ? r + 1 : BOARD_WIDTH - r;
+  return (double) bonus / (BOARD_WIDTH * BOARD_WIDTH);
+}
+
+static void generate_pcentral() {
+  printf("// PCENTRAL bonus of a Pawn on (file, rank), fixed point\n");
+  printf("static const int32_t pcentral_table[BOARD_WIDTH][BOARD_WIDTH] = {\n");
+  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+    printf("  {");
+    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+      printf(" %6d,", to_fixed(pcentral(f, r)));
     }
-    fprintf(fp, "},\n");
+    printf(" },\n");
   }
-  fprintf(fp, "};");
-  fclose(fp);
-};
-
-// Using our valid fil_of method, generate a file that is formatted as a precomputed table for these values
-void generate_fil_table(){
-  FILE *fp = fopen("fil_table.c", "wb");
-  int x;
-  fprintf(fp, "static const unsigned int fil_table[216] = {\n");
-  for (x = 0; x < 216; x++) {
-    if (fil_of((square_t)x) < 0) {
-      fprintf(fp, "-%d, ", -(int)fil_of((square_t)x));
-    } else {
-      fprintf(fp, "%d, ", (int)fil_of((square_t)x));
-    }
-    if ((x + 1) % 16 == 0) {
-      fprintf(fp, "\n");
+  printf("};\n\n");
+}
+
+static void generate_h_dist() {
+  printf("// h_dist between two squares, by bitboard index, times H_DIST_SCALE\n");
+  printf("static const uint16_t h_dist_table[BB_SQUARES][BB_SQUARES] = {\n");
+  for (int a = 0; a < BB_SQUARES; a++) {
+    printf("  {");
+    for (int b = 0; b < BB_SQUARES; b++) {
+      if (b % BOARD_WIDTH == 0 && b > 0) {
+        printf("\n   ");
+      }
+      printf(" %4d,", h_dist(a, b));
     }
+    printf(" },\n");
   }
-  fprintf(fp, "};");
-  fclose(fp);
-};
-
-// Using our valid rnk_of method, generate a file that is formatted as a precomputed table for these values
-void generate_rnk_table() {
-  FILE *fp = fopen("rnk_table.c", "wb");
-  int x;
-  fprintf(fp, "static const unsigned int rnk_table[216] = {\n");
-  for (x = 0; x < 216; x++) {
-    fprintf(fp, "%d, ", (int)rnk_of((square_t)x));
-    if ((x + 1) % 16 == 0) {
-      fprintf(fp, "\n");
+  printf("};\n\n");
+}
+
+static void generate_kface() {
+  printf("// KFACE bonus of a King with orientation ori, when the other King is\n");
+  printf("// delta_fil files and delta_rnk ranks away:\n");
+  printf("//   kface_table[ori][delta_fil + BOARD_WIDTH - 1][delta_rnk + BOARD_WIDTH - 1]\n");
+  printf("// fixed point\n");
+  printf("static const int32_t kface_table[NUM_ORI][2 * BOARD_WIDTH - 1][2 * BOARD_WIDTH - 1] = {\n");
+  for (int ori = 0; ori < NUM_ORI; ori++) {
+    printf("  {\n");
+    for (int df = 0; df < KING_DELTAS; df++) {
+      printf("    {");
+      for (int dr = 0; dr < KING_DELTAS; dr++) {
+        printf(" %6d,", to_fixed(kface(ori, df - (BOARD_WIDTH - 1),
+                                       dr - (BOARD_WIDTH - 1))));
+      }
+      printf(" },\n");
     }
+    printf("  },\n");
   }
-  fprintf(fp, "};");
-  fclose(fp);
-};
-
-
-// PCENTRAL heuristic: Bonus for Pawn near center of board
-double pcentral(fil_t f, rnk_t r) {
-  double df = BOARD_WIDTH/2 - f - 1;
-  if (df < 0)  df = f - BOARD_WIDTH/2;
-  double dr = BOARD_WIDTH/2 - r - 1;
-  if (dr < 0) dr = r - BOARD_WIDTH/2;
-  double bonus = 1 - sqrt(df * df + dr * dr) / (BOARD_WIDTH / sqrt(2));
-//  printf("%lf\n", bonus);
-
-//  printf("Pcentral = %lf", PCENTRAL);
-  return bonus;
+  printf("};\n\n");
 }
 
-// Using our valid pcentral method, generate a file that is formatted as a precomputed table for these values
-void generate_pcentral(){
-  FILE *fp = fopen("pcentral_table.c", "wb");
-  int x;
-  int y;
-  fprintf(fp, "static const int pcentral_table[13][15] = {\n");
-  for (x = 0; x < 16; x++) {
-    fprintf(fp, "{");
-    for (y = 0; y < 16; y++) {
-//      if (square_of(x-3, y-3) < 0) {
-//        fprintf(fp, "PRIu32, ", (uint32_t)-pcentral(x-3,y-3));
-//      } else {
-        printf("%lf", pcentral((fil_t)x,(rnk_t)y));
-        fprintf(fp, "%lf, ", pcentral((fil_t)x,(rnk_t)y));
-//      }
+static void generate_kaggressive() {
+  printf("// KAGGRESSIVE bonus of a King when the other King is on another square,\n");
+  printf("// both by bitboard index, fixed point\n");
+  printf("static const int32_t kaggressive_table[BB_SQUARES][BB_SQUARES] = {\n");
+  for (int a = 0; a < BB_SQUARES; a++) {
+    printf("  {");
+    for (int b = 0; b < BB_SQUARES; b++) {
+      if (b % BOARD_WIDTH == 0 && b > 0) {
+        printf("\n   ");
+      }
+      printf(" %5d,", to_fixed(kaggressive(fil_of_index(a), rnk_of_index(a),
+                                           fil_of_index(b), rnk_of_index(b))));
     }
-    fprintf(fp, "},\n");
+    printf(" },\n");
   }
-  fprintf(fp, "};");
+  printf("};\n\n");
 }
 
-
 int main() {
-//   generate_h_dist_table();
-//  generate_fil_table();
-//  generate_rnk_table();
-//  generate_square_table();
+  printf("// Generated by table_generator.c (make precomp_tables.h); do not edit.\n\n");
+  printf("#ifndef PRECOMP_TABLES_H\n");
+  printf("#define PRECOMP_TABLES_H\n\n");
+  printf("#include <stdint.h>\n\n");
+  printf("#define EVAL_TABLE_SHIFT %d\n", EVAL_TABLE_SHIFT);
+  printf("#define H_DIST_SCALE %d\n\n", H_DIST_SCALE);
+
   generate_pcentral();
+  generate_h_dist();
+  generate_kface();
+  generate_kaggressive();
 
+  printf("#endif  // PRECOMP_TABLES_H\n");
   return 0;
 }
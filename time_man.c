@@ -0,0 +1,150 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Time management, see time_man.h.
+
+#include "./time_man.h"
+
+#include "./util.h"
+
+// Moves the rest of the game is planned for when movestogo is not given
+#define MOVES_TO_GO 50
+
+// Share of the increment spent on every move
+#define INC_USED 0.8
+
+// Without movestogo, never plan on more than this share of the clock
+#define MAX_CLOCK_SHARE 0.1
+
+// Never use more than this share of the clock, even on the last move before
+// the time control
+#define MAX_CLOCK_USE 0.8
+
+// The maximum time, as a multiple of the optimum time
+#define MAX_STRETCH 3.0
+
+// The optimum time is scaled by STABLE_SCALE + CHANGE_SCALE * changes, where
+// changes counts best move changes and halves every iteration.
+#define STABLE_SCALE 0.8
+#define CHANGE_SCALE 0.5
+
+// ... and by 1 + DROP_SCALE * drop / PAWN_VALUE when the score drops, up to a
+// drop of DROP_CAP.
+#define DROP_SCALE 1.0
+#define DROP_CAP PAWN_VALUE
+
+// The next iteration is started if it is predicted to end by this many
+// times the scaled optimum time (and by the maximum time).
+#define ITERATION_OVERRUN 1.5
+
+// Branching factor assumed until it has been measured, and its bounds
+#define DEFAULT_EBF 3.0
+#define MIN_EBF 1.5
+#define MAX_EBF 8.0
+
+// Iterations shorter than this, in ms, are too noisy to time
+#define MIN_TIMED_ITERATION 1.0
+
+static struct {
+  bool flexible;  // timed by the clock rather than by movetime
+  double optimum;
+  double maximum;
+  double iteration_start;  // milliseconds() at the start of this iteration
+  double last_duration;    // of the previous iteration, or 0
+  double ebf;              // time of an iteration over that of the last one
+  double changes;          // decaying count of best move changes
+  move_t best_move;        // of the previous iteration
+  score_t score;           // ...
+} tm;
+
+static double min_double(double a, double b) {
+  return a < b ? a : b;
+}
+
+bool tm_timed(const timeLimits *limits) {
+  return limits->movetime > 0 || limits->time > 0;
+}
+
+static void time_budget(const timeLimits *limits, double *optimum,
+                        double *maximum) {
+  if (limits->movetime > 0) {
+    *optimum = limits->movetime;
+    *maximum = limits->movetime;
+    return;
+  }
+  if (limits->time <= 0) {
+    *optimum = INF_TIME;
+    *maximum = INF_TIME;
+    return;
+  }
+
+  int moves = MOVES_TO_GO;
+  double share = MAX_CLOCK_SHARE;
+  if (limits->movestogo > 0 && limits->movestogo < MOVES_TO_GO) {
+    moves = limits->movestogo;
+    share = 1.0 / moves;
+  }
+  *optimum = min_double(limits->time / moves + limits->inc * INC_USED,
+                        limits->time * share);
+  *maximum = min_double(*optimum * MAX_STRETCH, limits->time * MAX_CLOCK_USE);
+  *optimum = min_double(*optimum, *maximum);
+}
+
+double tm_maximum_time(const timeLimits *limits) {
+  double optimum, maximum;
+  time_budget(limits, &optimum, &maximum);
+  return maximum;
+}
+
+void tm_start(const timeLimits *limits) {
+  // movetime is spent in full; the abort timer ends the search
+  tm.flexible = limits->movetime <= 0 && limits->time > 0;
+  time_budget(limits, &tm.optimum, &tm.maximum);
+  tm.iteration_start = milliseconds();
+  tm.last_duration = 0.0;
+  tm.ebf = DEFAULT_EBF;
+  tm.changes = 0.0;
+  tm.best_move = 0;
+  tm.score = 0;
+}
+
+bool tm_next_iteration(int depth, move_t best_move, score_t score,
+                       double elapsed) {
+  // Durations are taken from our own clock, which ponderhit does not reset
+  const double now = milliseconds();
+  const double duration = now - tm.iteration_start;
+  tm.iteration_start = now;
+  if (tm.last_duration >= MIN_TIMED_ITERATION) {
+    // Averaged with the last ratio, as odd and even depths grow differently
+    double ebf = (tm.ebf + duration / tm.last_duration) / 2;
+    tm.ebf = ebf < MIN_EBF ? MIN_EBF : (ebf > MAX_EBF ? MAX_EBF : ebf);
+  }
+  tm.last_duration = duration;
+
+  tm.changes /= 2;
+  double drop = 0.0;
+  if (depth > 1) {
+    if (best_move != tm.best_move) {
+      tm.changes += 1.0;
+    }
+    drop = tm.score - score;
+  }
+  tm.best_move = best_move;
+  tm.score = score;
+
+  if (!tm.flexible) {
+    return true;
+  }
+
+  double scale = STABLE_SCALE + CHANGE_SCALE * tm.changes;
+  if (drop > 0) {
+    scale *= 1.0 + DROP_SCALE * min_double(drop, DROP_CAP) / PAWN_VALUE;
+  }
+  const double target = min_double(tm.optimum * scale, tm.maximum);
+  if (elapsed >= target) {
+    return false;
+  }
+
+  // An iteration cut off by the abort timer is mostly wasted
+  const double predicted_end = elapsed + duration * tm.ebf;
+  return predicted_end <= min_double(target * ITERATION_OVERRUN, tm.maximum);
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Time management: how long to search a move.
+//
+// A timed search has two limits.  The maximum time is a hard limit, enforced
+// by the abort timer (see init_abort_timer).  The optimum time is what the
+// search plans to use; it is stretched when the best move keeps changing or
+// the score drops, and shrunk when the best move is stable.  After every
+// iteration, the time of the next one is predicted from the growth of the
+// last ones, and the next iteration is only started if it is likely to end
+// in time, since an iteration that is cut off is mostly wasted.
+//
+// With movetime, the optimum and the maximum time are both movetime, and
+// the search runs until the abort timer ends it.
+
+#ifndef TIME_MAN_H
+#define TIME_MAN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "./move_gen.h"
+#include "./search.h"
+
+#define INF_TIME 99999999999.0
+
+// Limits of one search, as given to go.  A field that is 0 is not set.
+typedef struct timeLimits {
+  double time;      // ms left on our clock
+  double inc;       // ms added to our clock after every move
+  int movestogo;    // moves until the clock gets more time
+  double movetime;  // ms to search this move
+  uint64_t nodes;   // nodes to search at most, see set_node_limit
+} timeLimits;
+
+// Whether limits set a time limit
+bool tm_timed(const timeLimits *limits);
+
+// The hard limit of a search with limits in ms, or INF_TIME if untimed
+double tm_maximum_time(const timeLimits *limits);
+
+// Starts timing a search with limits.
+void tm_start(const timeLimits *limits);
+
+// Called after every completed iteration of the search, with the best move
+// and score it found and the time since the search started.  Returns true if
+// the next iteration should be started.
+bool tm_next_iteration(int depth, move_t best_move, score_t score,
+                       double elapsed);
+
+#endif  // TIME_MAN_H
@@ -4,8 +4,14 @@
 
 #include "./tt.h"
 
+#include <fcntl.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "./scheduler.h"
 #include "./tbassert.h"
 
 int HASH;     // hash table size in MBytes
@@ -14,21 +20,82 @@ int USE_TT;   // Use the transposition table.
 
 // the actual record that holds the data for the transposition
 // typedef to be ttRec_t in tt.h
+//
+// Everything but the key is packed into data, so that a record is 16 bytes
+// and a set of 4 records fills one cache line.
+//
+// Workers read and write the table without locks.  A record stores
+// key ^ data rather than the key, so a record torn by two concurrent writers
+// (data from one, check from the other) does not match either key, and is
+// a miss rather than another position's move and score.
 struct ttRec {
-  uint64_t  key;
-  move_t    move;
-  score_t   score;
-  int       quality;
-  ttBound_t bound;
-  int       age;
+  uint64_t check;  // key ^ data; both 0 if the record is unused
+  uint64_t data;   // see below
 };
 
+// Fields of ttRec.data
+#define REC_MOVE_SHIFT   0   // move, 20 bits (MOVE_MASK)
+#define REC_SCORE_SHIFT  20  // score_t, 16 bits
+#define REC_DEPTH_SHIFT  36  // quality (search depth), signed 8 bits
+#define REC_BOUND_SHIFT  44  // ttBound_t, 2 bits
+#define REC_AGE_SHIFT    46  // hashtable.age when written, 8 bits
+
+static uint64_t pack_rec(move_t move, score_t score, int depth,
+                         ttBound_t bound, unsigned age) {
+  tbassert(depth >= INT8_MIN && depth <= INT8_MAX, "depth = %d\n", depth);
+  return ((uint64_t) (move & MOVE_MASK) << REC_MOVE_SHIFT) |
+      ((uint64_t) (uint16_t) score << REC_SCORE_SHIFT) |
+      ((uint64_t) (uint8_t) depth << REC_DEPTH_SHIFT) |
+      ((uint64_t) bound << REC_BOUND_SHIFT) |
+      ((uint64_t) (age & 0xff) << REC_AGE_SHIFT);
+}
+
+static inline move_t rec_move(const ttRec_t *rec) {
+  return (rec->data >> REC_MOVE_SHIFT) & MOVE_MASK;
+}
+
+static inline score_t rec_score(const ttRec_t *rec) {
+  return (score_t) (uint16_t) (rec->data >> REC_SCORE_SHIFT);
+}
+
+static inline int rec_quality(const ttRec_t *rec) {
+  return (int8_t) (uint8_t) (rec->data >> REC_DEPTH_SHIFT);
+}
+
+static inline ttBound_t rec_bound(const ttRec_t *rec) {
+  return (ttBound_t) ((rec->data >> REC_BOUND_SHIFT) & 3);
+}
+
+static inline unsigned rec_age(const ttRec_t *rec) {
+  return (rec->data >> REC_AGE_SHIFT) & 0xff;
+}
+
+static inline uint64_t rec_key(const ttRec_t *rec) {
+  return rec->check ^ rec->data;
+}
+
+static inline bool rec_is_used(const ttRec_t *rec) {
+  return rec->check != 0 || rec->data != 0;
+}
+
+// Other workers may be writing *rec, so it is read and written a word at a
+// time, and only a copy is ever decoded.
+static inline void load_rec(const ttRec_t *rec, ttRec_t *copy) {
+  copy->data = __atomic_load_n(&rec->data, __ATOMIC_RELAXED);
+  copy->check = __atomic_load_n(&rec->check, __ATOMIC_RELAXED);
+}
+
+static inline void store_rec(ttRec_t *rec, uint64_t key, uint64_t data) {
+  __atomic_store_n(&rec->data, data, __ATOMIC_RELAXED);
+  __atomic_store_n(&rec->check, key ^ data, __ATOMIC_RELAXED);
+}
+
 
 // each set is a 4-way set-associative cache and contains 4 records
-#define RECORDS_PER_SET 1
+#define RECORDS_PER_SET 4
 typedef struct {
   ttRec_t records[RECORDS_PER_SET];
-} ttSet_t;
+} __attribute__((aligned(64))) ttSet_t;
 
 
 // struct def for the global transposition table
@@ -37,17 +104,26 @@ struct ttHashtable {
   uint64_t mask;           // a mask to map from key to set index
   unsigned age;
   ttSet_t *tt_set;         // array of sets that contains the transposition
+  size_t num_of_bytes;     // of tt_set
+  void *map;               // the mapping that holds tt_set, see
+  size_t map_bytes;        //   alloc_sets and tt_load_hashtable
+  const char *page_kind;   // what backs tt_set
 } hashtable;  // name of the global transposition table
 
+#define HUGE_PAGE_SIZE (2ULL << 20)
+
+// Bytes cleared by one task of tt_clear_hashtable
+#define CLEAR_CHUNK_SIZE HUGE_PAGE_SIZE
+
 
 // getting the move out of the record
 move_t tt_move_of(ttRec_t *rec) {
-  return rec->move;
+  return rec_move(rec);
 }
 
 // getting the score out of the record
 score_t tt_score_of(ttRec_t *rec) {
-  return rec->score;
+  return rec_score(rec);
 }
 
 size_t tt_get_bytes_per_record() {
@@ -58,6 +134,55 @@ uint32_t tt_get_num_of_records() {
   return hashtable.num_of_sets * RECORDS_PER_SET;
 }
 
+const char *tt_get_page_kind() {
+  return hashtable.page_kind;
+}
+
+// Maps num_of_bytes for the sets, backed by huge pages if possible, so that
+// probes do not miss in the TLB: explicit huge pages if some are reserved
+// (vm.nr_hugepages), else transparent ones, else normal pages.  Returns NULL
+// if there is not enough memory.
+static ttSet_t *alloc_sets(size_t num_of_bytes) {
+  void *mem;
+#ifdef MAP_HUGETLB
+  if (num_of_bytes % HUGE_PAGE_SIZE == 0) {
+    mem = mmap(NULL, num_of_bytes, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mem != MAP_FAILED) {
+      hashtable.page_kind = "huge";
+      return (ttSet_t *) mem;
+    }
+  }
+#endif
+
+  hashtable.page_kind = "normal";
+  if (num_of_bytes < HUGE_PAGE_SIZE) {
+    mem = mmap(NULL, num_of_bytes, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return mem == MAP_FAILED ? NULL : (ttSet_t *) mem;
+  }
+
+  // Transparent huge pages must be aligned, so map a huge page more than
+  // needed and unmap the ends.
+  mem = mmap(NULL, num_of_bytes + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED) {
+    return NULL;
+  }
+  char *start = (char *) (((uintptr_t) mem + HUGE_PAGE_SIZE - 1) &
+                          ~(uintptr_t) (HUGE_PAGE_SIZE - 1));
+  if (start > (char *) mem) {
+    munmap(mem, start - (char *) mem);
+  }
+  munmap(start + num_of_bytes, (char *) mem + HUGE_PAGE_SIZE - start);
+#ifdef MADV_HUGEPAGE
+  if (madvise(start, num_of_bytes, MADV_HUGEPAGE) == 0) {
+    hashtable.page_kind = "transparent huge";
+  }
+#endif
+  return (ttSet_t *) start;
+}
+
 void tt_resize_hashtable(int size_in_meg) {
   uint64_t size_in_bytes = (uint64_t) size_in_meg * (1ULL << 20);
   // total number of sets we could have in the hashtable
@@ -72,16 +197,21 @@ void tt_resize_hashtable(int size_in_meg) {
   hashtable.mask = num_of_sets - 1;
   hashtable.age = 0;
 
-  free(hashtable.tt_set);  // free the old ones
-  hashtable.tt_set = (ttSet_t *) malloc(sizeof(ttSet_t) * num_of_sets);
+  tt_free_hashtable();  // free the old ones
+  hashtable.num_of_bytes = sizeof(ttSet_t) * num_of_sets;
+  hashtable.tt_set = alloc_sets(hashtable.num_of_bytes);
 
   if (hashtable.tt_set == NULL) {
     fprintf(stderr,  "Hash table too big\n");
     exit(1);
   }
+  hashtable.map = hashtable.tt_set;
+  hashtable.map_bytes = hashtable.num_of_bytes;
 
-  // might as well clear the table while we are at it
-  memset(hashtable.tt_set, 0, sizeof(ttSet_t) * hashtable.num_of_sets);
+  // The mapping is zero already, but clearing it in parallel is what puts
+  // the pages in memory, spread over the workers' NUMA nodes rather than
+  // all on the first one to probe.
+  tt_clear_hashtable();
 }
 
 void tt_make_hashtable(int size_in_meg) {
@@ -90,7 +220,9 @@ void tt_make_hashtable(int size_in_meg) {
 }
 
 void tt_free_hashtable() {
-  free(hashtable.tt_set);
+  if (hashtable.tt_set != NULL) {
+    munmap(hashtable.map, hashtable.map_bytes);
+  }
   hashtable.tt_set = NULL;
 }
 
@@ -99,8 +231,17 @@ void tt_age_hashtable() {
   hashtable.age++;
 }
 
+static void clear_chunk(void *arg, int i) {
+  char *start = (char *) hashtable.tt_set + (size_t) i * CLEAR_CHUNK_SIZE;
+  size_t size = hashtable.num_of_bytes - (size_t) i * CLEAR_CHUNK_SIZE;
+  memset(start, 0, size < CLEAR_CHUNK_SIZE ? size : CLEAR_CHUNK_SIZE);
+}
+
+// Cleared by all the workers, so that each first touches part of the table.
 void tt_clear_hashtable() {
-  memset(hashtable.tt_set, 0, sizeof(ttSet_t) * hashtable.num_of_sets);
+  const int num_of_chunks = (hashtable.num_of_bytes + CLEAR_CHUNK_SIZE - 1) /
+      CLEAR_CHUNK_SIZE;
+  sched_parallel_for(0, num_of_chunks, clear_chunk, NULL);
   hashtable.age = 0;
 }
 
@@ -114,49 +255,137 @@ void tt_hashtable_put(uint64_t key, int depth, score_t score,
   ttRec_t *curr_rec = hashtable.tt_set[set_index].records;
   // best record to replace that we found so far
   ttRec_t *rec_to_replace = curr_rec;
-  int replacemt_val = -99;            // value of doing the replacement
+  int replacemt_val = INT_MAX;        // value of keeping rec_to_replace
 
+  const unsigned age = hashtable.age & 0xff;
   move = move & MOVE_MASK;
 
   for (int i = 0; i < RECORDS_PER_SET; i++, curr_rec++) {
-    int value = 0;  // points for sorting
+    ttRec_t rec;
+    load_rec(curr_rec, &rec);
 
     // always use entry if it's not used or has same key
-    if (!curr_rec->key || key == curr_rec->key) {
-      if (move == 0) {
-        move = curr_rec->move;
+    if (!rec_is_used(&rec) || key == rec_key(&rec)) {
+      if (move == 0 && rec_is_used(&rec)) {
+        move = rec_move(&rec);
       }
-      curr_rec->key = key;
-      curr_rec->quality = depth;
-      curr_rec->move = move;
-      curr_rec->age = hashtable.age;
-      curr_rec->score = score;
-      curr_rec->bound = (ttBound_t) bound_type;
-
-      return;
+      rec_to_replace = curr_rec;
+      break;
     }
 
-    // otherwise, potential candidate for replacement
-    if (curr_rec->age == hashtable.age) {
-      value -= 6;   // prefer not to replace if same age
-    }
-    if (curr_rec->quality < rec_to_replace->quality) {
-      value += 1;   // prefer to replace if worse quality
+    // otherwise, potential candidate for replacement: records from earlier
+    // searches go first, then the shallowest
+    int value = rec_quality(&rec);
+    if (rec_age(&rec) != age) {
+      value -= 256;
     }
-    if (value > replacemt_val) {
+    if (value < replacemt_val) {
       replacemt_val = value;
       rec_to_replace = curr_rec;
     }
   }
   // update the record that we are replacing with this record
-  rec_to_replace->key = key;
-  rec_to_replace->quality = depth;
-  rec_to_replace->move = move;
-  rec_to_replace->age = hashtable.age;
-  rec_to_replace->score = score;
-  rec_to_replace->bound = (ttBound_t) bound_type;
+  store_rec(rec_to_replace, key,
+            pack_rec(move, score, depth, (ttBound_t) bound_type, age));
+}
+
+
+// -----------------------------------------------------------------------------
+// Hash table files
+//
+// A file is a header, padded to a page, followed by the sets exactly as they
+// are in memory, so that loading maps the file rather than reading it.
+// Bump HASH_FILE_VERSION whenever ttRec changes.
+// -----------------------------------------------------------------------------
+
+#define HASH_FILE_MAGIC 0x4853414853524c4cULL  // "LLRSHASH"
+#define HASH_FILE_VERSION 1
+#define HASH_FILE_HEADER_SIZE 4096
+
+typedef struct {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t bytes_per_record;
+  uint32_t records_per_set;
+  uint32_t age;            // hashtable.age when saved
+  uint64_t num_of_sets;
+  uint64_t zob_id;         // see tt.h
+} hashFileHeader;
+
+bool tt_save_hashtable(const char *filename, uint64_t zob_id) {
+  FILE *f = fopen(filename, "wb");
+  if (f == NULL) {
+    return false;
+  }
+
+  char header[HASH_FILE_HEADER_SIZE] = { 0 };
+  hashFileHeader h = {
+    .magic = HASH_FILE_MAGIC,
+    .version = HASH_FILE_VERSION,
+    .bytes_per_record = sizeof(ttRec_t),
+    .records_per_set = RECORDS_PER_SET,
+    .age = hashtable.age,
+    .num_of_sets = hashtable.num_of_sets,
+    .zob_id = zob_id
+  };
+  memcpy(header, &h, sizeof(h));
+
+  bool ok = fwrite(header, 1, sizeof(header), f) == sizeof(header) &&
+      fwrite(hashtable.tt_set, 1, hashtable.num_of_bytes, f) == hashtable.num_of_bytes;
+  return fclose(f) == 0 && ok;
+}
+
+bool tt_load_hashtable(const char *filename, uint64_t zob_id) {
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  hashFileHeader h;
+  struct stat st;
+  bool ok = fstat(fd, &st) == 0 &&
+      pread(fd, &h, sizeof(h), 0) == sizeof(h) &&
+      h.magic == HASH_FILE_MAGIC &&
+      h.version == HASH_FILE_VERSION &&
+      h.bytes_per_record == sizeof(ttRec_t) &&
+      h.records_per_set == RECORDS_PER_SET &&
+      h.zob_id == zob_id &&
+      h.num_of_sets > 0 && (h.num_of_sets & (h.num_of_sets - 1)) == 0 &&
+      (uint64_t) st.st_size == HASH_FILE_HEADER_SIZE + h.num_of_sets * sizeof(ttSet_t);
+
+  // Private, so that the search writes to its own copies of the pages and
+  // never to the file
+  void *map = MAP_FAILED;
+  if (ok) {
+    map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (map == MAP_FAILED) {
+    return false;
+  }
+
+  tt_free_hashtable();
+  hashtable.map = map;
+  hashtable.map_bytes = st.st_size;
+  hashtable.tt_set = (ttSet_t *) ((char *) map + HASH_FILE_HEADER_SIZE);
+  hashtable.num_of_sets = h.num_of_sets;
+  hashtable.mask = h.num_of_sets - 1;
+  hashtable.num_of_bytes = h.num_of_sets * sizeof(ttSet_t);
+  hashtable.page_kind = "file";
+  HASH = hashtable.num_of_bytes >> 20;
+
+  // Every record loaded now counts as from an earlier search: it is used,
+  // but replaced before the records of this session.
+  hashtable.age = h.age + 1;
+  return true;
+}
+
+void tt_prefetch(uint64_t key) {
+  __builtin_prefetch(&hashtable.tt_set[key & hashtable.mask]);
 }
 
+// The record found is copied here, see tt.h
+static __thread ttRec_t found_rec;
 
 ttRec_t *tt_hashtable_get(uint64_t key) {
   if (!USE_TT) {
@@ -166,13 +395,13 @@ ttRec_t *tt_hashtable_get(uint64_t key) {
   uint64_t set_index = key & hashtable.mask;
   ttRec_t *rec = hashtable.tt_set[set_index].records;
 
-  ttRec_t *found = NULL;
   for (int i = 0; i < RECORDS_PER_SET; i++, rec++) {
-    if (rec->key == key) {  // found the record that we are looking for
-      found = rec;
+    load_rec(rec, &found_rec);
+    if (rec_key(&found_rec) == key) {  // found the record that we are looking for
+      return &found_rec;
     }
   }
-  return found;
+  return NULL;
 }
 
 
@@ -189,7 +418,7 @@ score_t lose_in(int ply) {
 // when you retrieve the score from the hashtable, however, you want to
 // consider the value of the position based on where you are in the search tree
 score_t tt_adjust_score_from_hashtable(ttRec_t *rec, int ply_in_search) {
-  score_t score = rec->score;
+  score_t score = rec_score(rec);
   if (score >= win_in(MAX_PLY_IN_SEARCH)) {
     return score - ply_in_search;
   }
@@ -215,14 +444,16 @@ score_t tt_adjust_score_for_hashtable(score_t score, int ply_in_search) {
 bool tt_is_usable(ttRec_t *tt, int depth, score_t beta) {
   // can't use this record if we are searching at depth higher than the
   // depth of this record.
-  if (tt->quality < depth) {
+  if (rec_quality(tt) < depth) {
     return false;
   }
   // otherwise check whether the score falls within the bounds
-  if ((tt->bound == LOWER) && tt->score >= beta) {
+  const ttBound_t bound = rec_bound(tt);
+  const score_t score = rec_score(tt);
+  if ((bound == LOWER) && score >= beta) {
     return true;
   }
-  if ((tt->bound == UPPER) && tt->score < beta) {
+  if ((bound == UPPER) && score < beta) {
     return true;
   }
 
@@ -31,17 +31,33 @@ score_t tt_score_of(ttRec_t *tt);
 
 size_t tt_get_bytes_per_record();
 uint32_t tt_get_num_of_records();
+// "huge", "transparent huge", "normal" or "file": the pages the table is in
+const char *tt_get_page_kind();
 
 // operations on the global hashtable
 void tt_make_hashtable(int sizeMeg);
 void tt_resize_hashtable(int sizeInMeg);
 void tt_free_hashtable();
 void tt_age_hashtable();
+void tt_clear_hashtable();
+
+// Saving the hashtable to a file, and replacing it with one saved before.
+// zob_id identifies the Zobrist keys (any key of a fixed position will do),
+// so that a file is not loaded by a build that hashes positions differently.
+// Both return false on failure; a failed load leaves the table as it was.
+bool tt_save_hashtable(const char *filename, uint64_t zob_id);
+bool tt_load_hashtable(const char *filename, uint64_t zob_id);
 
 // putting / getting transposition data into / from hashtable
+//
+// Any number of workers may put and get at the same time.  The record
+// returned by tt_hashtable_get is a copy that belongs to the calling thread
+// and is overwritten by its next call.
 void tt_hashtable_put(uint64_t key, int depth, score_t score,
                       int type, move_t move);
 ttRec_t *tt_hashtable_get(uint64_t key);
+// Starts loading the set of key into the cache, for a get soon after.
+void tt_prefetch(uint64_t key);
 
 score_t tt_adjust_score_from_hashtable(ttRec_t *rec, int ply);
 score_t tt_adjust_score_for_hashtable(score_t score, int ply);
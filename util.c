@@ -40,14 +40,29 @@ double milliseconds() {
 }
 
 // Public domain code for JLKISS64 RNG - long period KISS RNG producing
-// 64-bit results
+// 64-bit results.  The state is per thread, so that search threads can
+// shuffle their root moves at the same time.
+static __thread uint64_t x = 123456789123ULL, y = 987654321987ULL;
+static __thread unsigned int z1 = 43219876, c1 = 6543217, z2 = 21987643,
+    c2 = 1732654;  // Seed variables
+
+// Every thread starts from the same state; threads that must not produce the
+// same numbers give themselves different seeds.
+void myrand_seed(uint64_t seed) {
+  x = 123456789123ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+  y = 987654321987ULL ^ (seed * 0xBF58476D1CE4E5B9ULL);
+  if (y == 0) {
+    y = 987654321987ULL;  // Do not set y=0!
+  }
+  z1 = 43219876;
+  c1 = 6543217;
+  z2 = 21987643;
+  c2 = 1732654;
+}
+
 uint64_t myrand() {
-  static int first_time = 0;
-  // Seed variables
-  static uint64_t x = 123456789123ULL, y = 987654321987ULL;
-  static unsigned int z1 = 43219876, c1 = 6543217, z2 = 21987643,
-      c2 = 1732654;  // Seed variables
-  static uint64_t t;
+  static __thread int first_time = 0;
+  static __thread uint64_t t;
 
   if (first_time) {
     int  i;
@@ -33,5 +33,6 @@
 void debug_log(int log_level, const char *str, ...);
 double  milliseconds();
 uint64_t myrand();
+void myrand_seed(uint64_t seed);
 
 #endif  // UTIL_H